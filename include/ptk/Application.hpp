@@ -11,6 +11,7 @@
 // pTK Headers
 #include "ptk/Window.hpp"
 #include "ptk/core/ApplicationBase.hpp"
+#include "ptk/core/EventSources.hpp"
 
 // Temp.
 #include "ptk/platform/ApplicationHandle.hpp"
@@ -164,6 +165,68 @@ namespace pTK
         */
         [[nodiscard]] bool isTerminated() const noexcept { return m_terminated; }
 
+        /** Function for setting if window events should be coalesced.
+
+            Consecutive motion, scroll and resize events for the same window
+            are collapsed into one before they are dispatched.
+
+            @param value    coalesce events
+        */
+        void setEventCoalescing(bool value) noexcept;
+
+        /** Function for retrieving if window events are coalesced.
+
+            @return     status
+        */
+        [[nodiscard]] bool eventCoalescing() const noexcept;
+
+        /** Function for retrieving the number of window events that have been coalesced.
+
+            @return     number of coalesced events
+        */
+        [[nodiscard]] uint64_t coalescedEventCount() const noexcept;
+
+        /** Function for adding a timer that is run on the event loop thread.
+
+            Uses a monotonic clock.
+            Note: Must be called from the event loop thread.
+
+            @param delay        time until the timer runs (and interval if repeating)
+            @param callback     function to call
+            @param repeat       true if the timer should repeat
+            @return             timer id
+        */
+        EventSources::id_type addTimer(std::chrono::milliseconds delay, EventSources::timer_callback callback,
+                                       bool repeat = false);
+
+        /** Function for removing a timer.
+
+            @param id   timer id
+            @return     true if removed, otherwise false
+        */
+        bool removeTimer(EventSources::id_type id);
+
+        /** Function for adding a file descriptor watcher.
+
+            The file descriptor is waited on together with the platform events and
+            the callback is called on the event loop thread when it is ready.
+            Throws PlatformError if the platform does not support watchers.
+            Note: Must be called from the event loop thread.
+
+            @param fd           file descriptor
+            @param events       EventSources::Readable and/or EventSources::Writable
+            @param callback     function to call with the fd and the ready events
+            @return             watcher id
+        */
+        EventSources::id_type addWatch(int fd, uint32_t events, EventSources::watch_callback callback);
+
+        /** Function for removing a file descriptor watcher.
+
+            @param id   watcher id
+            @return     true if removed, otherwise false
+        */
+        bool removeWatch(EventSources::id_type id);
+
     public:
         /** Function for retrieving a pointer to the Application.
 
@@ -174,6 +237,12 @@ namespace pTK
         */
         static Application* Get();
 
+        /** Function for checking if the Application has been created.
+
+            @return     status
+        */
+        [[nodiscard]] static bool Exists() noexcept;
+
     private:
         /** Callback for when the application will begin to close.
 
@@ -9,8 +9,10 @@
 #define PTK_WINDOW_HPP
 
 // pTK Headers
-#include "ptk/core/CommandBuffer.hpp"
+#include "ptk/core/CommandQueue.hpp"
 #include "ptk/core/ContextBase.hpp"
+#include "ptk/core/DamageRegion.hpp"
+#include "ptk/core/FrameScheduler.hpp"
 #include "ptk/core/Widget.hpp"
 #include "ptk/core/WindowBase.hpp"
 #include "ptk/core/WindowInfo.hpp"
@@ -24,6 +26,7 @@
 #include <string>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace pTK
 {
@@ -56,6 +59,8 @@ namespace pTK
         /** Function for sending commands to the window.
 
             Commands will be put on a queue (FIFO) and the function returns instantly.
+            The queue is lock-free and the window is only notified when the queue
+            becomes non-empty, not for every command.
             Note: This function is thread safe.
         */
         template <typename Command>
@@ -86,6 +91,24 @@ namespace pTK
         */
         [[nodiscard]] std::size_t targetRefreshRate() const { return m_handle->targetRefreshRate(); }
 
+        /** Function for retrieving the refresh rate of the monitor the window is on.
+
+            @return     refresh rate in Hz
+        */
+        [[nodiscard]] double refreshRate() const { return m_handle->refreshRate(); }
+
+        /** Function for retrieving the time left until the next frame should be drawn.
+
+            @return     time until the next frame deadline
+        */
+        [[nodiscard]] FrameScheduler::duration timeUntilFrame() const { return m_scheduler.timeUntilFrame(); }
+
+        /** Function for retrieving the frame statistics of the window.
+
+            @return     frame times (p50 and p99) and missed deadlines
+        */
+        [[nodiscard]] FrameScheduler::Stats frameStats() const { return m_scheduler.stats(); }
+
         /** Function for retrieving the time past since last draw.
 
             @return     milliseconds since last draw
@@ -219,13 +242,37 @@ namespace pTK
         */
         [[nodiscard]] Size getContentSize() const { return m_context->getSize(); }
 
+        /** Function for painting and presenting a frame directly.
+
+            Damaged areas are painted (or everything if nothing is damaged).
+            Useful with the Headless backend, where painting is not triggered
+            by the platform.
+        */
+        void renderFrame();
+
+        /** Function for reading the pixels of the last painted frame.
+
+            Pixels are in a RGBA format (4 bytes per pixel, unpremultiplied)
+            with the size of getContentSize().
+
+            @return     pixels, empty on failure
+        */
+        [[nodiscard]] std::vector<uint8_t> readPixels() const;
+
+        /** Function for encoding the last painted frame as a PNG image.
+
+            @return     PNG data, empty on failure
+        */
+        [[nodiscard]] std::vector<uint8_t> encodePNG() const;
+
     private:
-        void onAdd(const value_type&) override;
+        void fitChildren() override;
         void onRemove(const value_type&) override;
         void onChildDraw(size_type) override;
         void onChildUpdate(size_type) override;
         void onSizeChange(const Size& size) override;
         void onLayoutChange() override;
+        void addDamage(const Rect& rect) override;
 
     private:
         // This draw function gets called from the backend.
@@ -248,10 +295,11 @@ namespace pTK
         void setLimitsWithSizePolicy();
 
     private:
-        mutable std::mutex m_commandBufferMutex{};
-        CommandBuffer<void()> m_commandBuffer{};
+        CommandQueue<void()> m_commands{};
         std::unique_ptr<Platform::WindowHandle> m_handle;
         std::unique_ptr<ContextBase> m_context;
+        DamageRegion m_damage{};
+        FrameScheduler m_scheduler{};
         std::chrono::time_point<std::chrono::steady_clock> m_lastDrawTime;
         std::thread::id m_threadID;
         std::atomic<bool> m_contentInvalidated{false};
@@ -261,12 +309,8 @@ namespace pTK
     template <typename Command>
     void Window::postCommand(Command cmd)
     {
-        {
-            std::lock_guard<std::mutex> lock{m_commandBufferMutex};
-            m_commandBuffer.add(std::move(cmd));
-        }
-
-        if (std::this_thread::get_id() != m_threadID)
+        // Commands posted from the window thread are run before it waits for events.
+        if (m_commands.push(std::move(cmd)) && (std::this_thread::get_id() != m_threadID))
             m_handle->notifyEvent();
     }
 
@@ -10,14 +10,15 @@
 
 // pTK Headers
 #include "ptk/core/Defines.hpp"
+#include "ptk/util/InplaceFunction.hpp"
 
 // C++ Headers
 #include <algorithm>
 #include <cstdint>
-#include <functional>
+#include <iterator>
 #include <memory>
 #include <typeindex>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace pTK
@@ -27,16 +28,24 @@ namespace pTK
         This class stores function pointers of type Callback
         and provides an API to access and modify them.
 
+        Callbacks are stored in an InplaceFunction, adding one
+        does not allocate anything else than the storage node.
+
         Callbacks are stored together with a unique identifier.
         This id will not be checked by this class, it is assumed
         that the user will provide a unique identifier.
+
+        Callbacks may add or remove callbacks while removeCallbackIf() is
+        dispatching. Removed callbacks are only marked as dead and erased
+        once the dispatch is done, added callbacks are buffered and appended
+        after the dispatch (they are not called in the same dispatch).
     */
     template <typename Callback>
     class CallbackContainer
     {
     public:
         // Type of callback that will be stored.
-        using callback_type = std::function<Callback>;
+        using callback_type = InplaceFunction<Callback>;
 
         // Each callback will be stored in a node together with
         // a unique identifier. Note: the uniqueness of the id will
@@ -46,10 +55,11 @@ namespace pTK
         {
             Node(uint64_t identifier, callback_type func)
                 : id{identifier},
-                  callback{func}
+                  callback{std::move(func)}
             {}
             uint64_t id;
             callback_type callback;
+            bool alive{true};
         };
 
         // Storage container.
@@ -72,7 +82,9 @@ namespace pTK
             @return    initialized CallbackContainer from value
         */
         CallbackContainer(CallbackContainer&& other) noexcept
-            : m_storage(std::move(other.m_storage))
+            : m_storage(std::move(other.m_storage)),
+              m_pending(std::move(other.m_pending)),
+              m_dead{std::exchange(other.m_dead, 0)}
         {}
 
         /** Deleted Copy Constructor.
@@ -89,6 +101,8 @@ namespace pTK
         CallbackContainer& operator=(CallbackContainer&& other) noexcept
         {
             m_storage = std::move(other.m_storage);
+            m_pending = std::move(other.m_pending);
+            m_dead = std::exchange(other.m_dead, 0);
             return *this;
         }
 
@@ -109,35 +123,85 @@ namespace pTK
         [[nodiscard]] CallbackContainer clone() const
         {
             CallbackContainer container{};
-            container.m_storage = m_storage; // Copy contents of storage.
+
+            // Copy contents of storage (only the alive callbacks).
+            container.m_storage.reserve(size());
+            for (const Node& node : m_storage)
+                if (node.alive)
+                    container.m_storage.push_back(node);
+            container.m_storage.insert(container.m_storage.end(), m_pending.cbegin(), m_pending.cend());
+
             return container;
         }
 
         /** Function for clearing the CallbackContainer.
 
+            If called during a dispatch, the callbacks are marked as dead
+            and erased when the dispatch is done.
         */
-        void clear() noexcept { m_storage.clear(); }
+        void clear() noexcept
+        {
+            m_pending.clear();
+
+            if (dispatching())
+            {
+                for (Node& node : m_storage)
+                    node.alive = false;
+                m_dead = m_storage.size();
+            }
+            else
+            {
+                m_storage.clear();
+                m_dead = 0;
+            }
+        }
 
         /** Function for adding a callback.
 
+            If called during a dispatch, the callback is added when the dispatch is done.
+
             @param id           unique identifier
             @param callback     function callback
         */
-        void addCallback(uint64_t id, const callback_type& callback) { m_storage.emplace_back(id, callback); }
+        void addCallback(uint64_t id, callback_type callback)
+        {
+            if (dispatching())
+                m_pending.emplace_back(id, std::move(callback));
+            else
+                m_storage.emplace_back(id, std::move(callback));
+        }
 
         /** Function for removing a callback.
 
+            If called during a dispatch, the callback is marked as dead
+            and erased when the dispatch is done.
+
             @param id       unique identifier
             @return         true if removed, otherwise false
         */
         bool removeCallback(uint64_t id)
         {
-            auto it =
-                std::find_if(m_storage.cbegin(), m_storage.cend(), [id](const Node& node) { return node.id == id; });
+            const auto pred = [id](const Node& node) { return node.alive && (node.id == id); };
 
-            if (it != m_storage.cend())
+            auto it = std::find_if(m_storage.begin(), m_storage.end(), pred);
+            if (it != m_storage.end())
             {
-                m_storage.erase(it);
+                if (dispatching())
+                {
+                    it->alive = false;
+                    ++m_dead;
+                }
+                else
+                    m_storage.erase(it);
+
+                return true;
+            }
+
+            // Not part of the dispatch, can be erased directly.
+            auto pending = std::find_if(m_pending.begin(), m_pending.end(), pred);
+            if (pending != m_pending.end())
+            {
+                m_pending.erase(pending);
                 return true;
             }
 
@@ -152,33 +216,78 @@ namespace pTK
         void triggerCallbacks(Args&&... args) const
         {
             for (auto it = m_storage.cbegin(); it != m_storage.cend(); ++it)
-                it->callback(std::forward<Args>(args)...);
+                if (it->alive)
+                    it->callback(std::forward<Args>(args)...);
         }
 
         /** Function for triggering and conditionally removing callbacks.
 
+            Callbacks are removed if the predicate returns true.
+            The predicate may add and remove callbacks, and dispatch
+            this container again (nested dispatches are supported).
+            Removed callbacks are erased in a single pass after the
+            outermost dispatch.
+
             @param p     predicate
         */
         template <typename UnaryPredicate>
         void removeCallbackIf(UnaryPredicate p)
         {
-            for (auto it = m_storage.begin(); it != m_storage.end();)
+            // Callbacks added during the dispatch are buffered in m_pending,
+            // the storage is not reallocated and the references stay valid.
+            ++m_dispatchDepth;
+            const std::size_t count{m_storage.size()};
+            for (std::size_t i{0}; i < count; ++i)
             {
-                if (p(*it))
-                    it = m_storage.erase(it);
-                else
-                    ++it;
+                Node& node{m_storage[i]};
+                if (node.alive && p(node) && node.alive)
+                {
+                    node.alive = false;
+                    ++m_dead;
+                }
             }
+            --m_dispatchDepth;
+
+            if (!dispatching())
+                compact();
         }
 
         /** Function for retrieving the callback count in the container.
 
             @return     number of callbacks
         */
-        [[nodiscard]] std::size_t size() const noexcept { return m_storage.size(); }
+        [[nodiscard]] std::size_t size() const noexcept { return m_storage.size() - m_dead + m_pending.size(); }
+
+        /** Function for checking if the container is dispatching callbacks.
+
+            @return     true if dispatching, otherwise false
+        */
+        [[nodiscard]] bool dispatching() const noexcept { return m_dispatchDepth > 0; }
+
+    private:
+        // Erases dead callbacks and adds the pending callbacks.
+        void compact()
+        {
+            if (m_dead > 0)
+            {
+                m_storage.erase(std::remove_if(m_storage.begin(), m_storage.end(),
+                                               [](const Node& node) { return !node.alive; }),
+                                m_storage.end());
+                m_dead = 0;
+            }
+
+            if (!m_pending.empty())
+            {
+                std::move(m_pending.begin(), m_pending.end(), std::back_inserter(m_storage));
+                m_pending.clear();
+            }
+        }
 
     private:
         container_type m_storage;
+        container_type m_pending{};
+        std::size_t m_dead{0};
+        uint32_t m_dispatchDepth{0};
     };
 
     // Unique type for T & Callback.
@@ -190,19 +299,36 @@ namespace pTK
     /** CallbackIndexGen class implementation.
 
         This class generates unique identifiers for every type T and
-        type Callback.
+        type Callback. The identifiers are small and dense (starting at 0)
+        and can be used to index a flat array.
     */
     struct PTK_API CallbackIndexGen
     {
+        using index_type = std::size_t;
+
         /** Function for generating a unique identifier.
 
+            The identifier is registered on the first call and only loaded
+            on every call after that.
+
             @return     unique identifier
         */
         template <typename T, typename Callback>
-        static std::type_index GetIndex()
+        static index_type GetIndex()
         {
-            return std::type_index(typeid(CallbackIndexType<T, Callback>));
+            static const index_type index{Register(std::type_index(typeid(CallbackIndexType<T, Callback>)))};
+            return index;
         }
+
+        /** Function for registering a type and retrieving its identifier.
+
+            Registering the same type again returns the same identifier,
+            this keeps the identifiers the same across shared libraries.
+
+            @param type     type to register
+            @return         unique identifier for type
+        */
+        static index_type Register(std::type_index type);
     };
 
     /** CallbackStorageNodeInterface struct implementation.
@@ -252,9 +378,9 @@ namespace pTK
     class PTK_API CallbackStorage
     {
     public:
-        using index_type = std::type_index;
+        using index_type = CallbackIndexGen::index_type;
         using node_type = std::unique_ptr<CallbackStorageNodeInterface>;
-        using container_type = std::unordered_map<index_type, node_type>;
+        using container_type = std::vector<node_type>;
 
     public:
         /** Constructs CallbackStorage with default values.
@@ -316,10 +442,11 @@ namespace pTK
         [[nodiscard]] CallbackStorage clone() const
         {
             CallbackStorage copy{};
-            copy.m_storage.reserve(m_storage.size());
+            copy.m_storage.resize(m_storage.size());
 
-            for (const auto& it : m_storage)
-                copy.m_storage.emplace(it.first, it.second->clone());
+            for (std::size_t i{0}; i < m_storage.size(); ++i)
+                if (m_storage[i])
+                    copy.m_storage[i] = m_storage[i]->clone();
 
             return copy;
         }
@@ -335,7 +462,7 @@ namespace pTK
             @return             unique identifier
         */
         template <typename T, typename Callback>
-        uint64_t addCallback(const std::function<Callback>& callback)
+        uint64_t addCallback(typename CallbackContainer<Callback>::callback_type callback)
         {
             // Get callbacks based on T & Callback types.
             CallbackContainer<Callback>* cont{getCallbackContainer<T, Callback>()};
@@ -348,7 +475,7 @@ namespace pTK
                 // Insert the callback.
                 // The id generated here must be unique (container assumes it is).
                 uint64_t id = s_idCounter++;
-                cont->addCallback(id, callback);
+                cont->addCallback(id, std::move(callback));
                 return id;
             }
 
@@ -371,8 +498,8 @@ namespace pTK
             {
                 auto status = cont->removeCallback(id);
 
-                // Remove node is no callbacks exists.
-                if (cont->size() == 0)
+                // Remove node is no callbacks exists (and it is not dispatching).
+                if ((cont->size() == 0) && !cont->dispatching())
                     removeNode<T, Callback>();
 
                 return status;
@@ -396,7 +523,8 @@ namespace pTK
             if (cont != nullptr)
             {
                 cont->clear();
-                removeNode<T, Callback>();
+                if (!cont->dispatching())
+                    removeNode<T, Callback>();
                 return true;
             }
 
@@ -455,8 +583,8 @@ namespace pTK
                 // Trigger and remove callbacks if necessary.
                 cont->removeCallbackIf(p);
 
-                // Remove node is no callbacks exists.
-                if (cont->size() == 0)
+                // Remove node is no callbacks exists (and it is not dispatching).
+                if ((cont->size() == 0) && !cont->dispatching())
                     removeNode<T, Callback>();
             }
         }
@@ -468,7 +596,11 @@ namespace pTK
 
             @return     number of containers in storage
         */
-        [[nodiscard]] std::size_t size() const noexcept { return m_storage.size(); }
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return static_cast<std::size_t>(std::count_if(m_storage.cbegin(), m_storage.cend(),
+                                                          [](const node_type& node) { return node != nullptr; }));
+        }
 
         /** Function for retrieving the amount of callbacks in the storage.
 
@@ -480,7 +612,8 @@ namespace pTK
 
             // Retrieve size of all containers.
             for (auto it{m_storage.cbegin()}; it != m_storage.cend(); ++it)
-                count += it->second->count();
+                if (*it)
+                    count += (*it)->count();
 
             return count;
         }
@@ -496,13 +629,11 @@ namespace pTK
             // Get index based on T and Callback types.
             const index_type index = CallbackIndexGen::GetIndex<T, Callback>();
 
-            // Get key/value pair count.
-            const auto count = m_storage.count(index);
-
-            if (count == 1)
+            if (index < m_storage.size())
             {
-                const CallbackStorageNodeInterface* node{m_storage.at(index).get()};
-                return static_cast<const CallbackContainer<Callback>*>(node->data());
+                const CallbackStorageNodeInterface* node{m_storage[index].get()};
+                if (node != nullptr)
+                    return static_cast<const CallbackContainer<Callback>*>(node->data());
             }
 
             return nullptr;
@@ -518,13 +649,11 @@ namespace pTK
             // Get index based on T and Callback types.
             const index_type index = CallbackIndexGen::GetIndex<T, Callback>();
 
-            // Get key/value pair count.
-            const auto count = m_storage.count(index);
-
-            if (count == 1)
+            if (index < m_storage.size())
             {
-                CallbackStorageNodeInterface* node{m_storage.at(index).get()};
-                return static_cast<CallbackContainer<Callback>*>(node->data());
+                CallbackStorageNodeInterface* node{m_storage[index].get()};
+                if (node != nullptr)
+                    return static_cast<CallbackContainer<Callback>*>(node->data());
             }
 
             return nullptr;
@@ -540,24 +669,20 @@ namespace pTK
             // Get index based on T and Callback types.
             const index_type index = CallbackIndexGen::GetIndex<T, Callback>();
 
-            // Get key/value pair count.
-            auto count = m_storage.count(index);
-
-            // Check how many pairs exists for that hash.
-            if (count == 0)
-            {
-                auto status = m_storage.emplace(index, std::make_unique<CallbackStorageNode<Callback>>());
+            if (index >= m_storage.size())
+                m_storage.resize(index + 1);
 
-                if (status.second)
-                    return static_cast<CallbackContainer<Callback>*>(status.first->second.get()->data());
-            }
+            // Node already exists.
+            if (m_storage[index] != nullptr)
+                return nullptr;
 
-            return nullptr;
+            m_storage[index] = std::make_unique<CallbackStorageNode<Callback>>();
+            return static_cast<CallbackContainer<Callback>*>(m_storage[index]->data());
         }
 
         /** Function to remove node based on T & Callback types.
 
-            Removes both the node and the index.
+            The slot is kept, only the node is removed.
         */
         template <typename T, typename Callback>
         void removeNode()
@@ -565,11 +690,8 @@ namespace pTK
             // Get index based on T and Callback types.
             const index_type index = CallbackIndexGen::GetIndex<T, Callback>();
 
-            // Get key/value pair count.
-            const auto count = m_storage.count(index);
-
-            if (count > 0)
-                m_storage.erase(index);
+            if (index < m_storage.size())
+                m_storage[index].reset();
         }
 
     private:
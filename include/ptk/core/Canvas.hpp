@@ -9,6 +9,7 @@
 #define PTK_CORE_CANVAS_HPP
 
 // pTK Headers
+#include "ptk/core/ShapedText.hpp"
 #include "ptk/core/Text.hpp"
 #include "ptk/util/Color.hpp"
 #include "ptk/util/Point.hpp"
@@ -81,6 +82,9 @@ namespace pTK
 
         /** Function for drawing a line of text.
 
+            Note: The text is shaped on every call, use drawShapedText for text
+            that is drawn more than once.
+
             @param data     str to draw, size of the ptr and encoding
             @param color    color of the text
             @param pos      draw text at
@@ -113,6 +117,36 @@ namespace pTK
         float drawTextLineWithPaint(const Text::StrData& data, const Vec2f& pos, const SkFont* font,
                                     SkPaint* paint) const;
 
+        /** Function for drawing shaped text.
+
+            @param text     shaped text to draw
+            @param color    color of the text
+            @param pos      draw text at
+            @return         advance
+        */
+        float drawShapedText(const ShapedText& text, const Color& color, const Vec2f& pos) const;
+
+        /** Function for drawing shaped text with outline.
+
+            @param text         shaped text to draw
+            @param color        color of the text
+            @param pos          draw text at
+            @param outlineSize  outline size
+            @param outColor     outline color
+            @return             advance
+        */
+        float drawShapedText(const ShapedText& text, const Color& color, const Vec2f& pos, float outlineSize,
+                             const Color& outColor) const;
+
+        /** Function for drawing shaped text.
+
+            @param text         shaped text to draw
+            @param pos          draw text at
+            @param paint        valid pointer to SkPaint
+            @return             advance
+        */
+        float drawShapedTextWithPaint(const ShapedText& text, const Vec2f& pos, SkPaint* paint) const;
+
         /** Function for drawing a SkImage.
 
             @param pos      draw rectangle at
@@ -121,6 +155,23 @@ namespace pTK
         */
         void drawImage(Point pos, Size size, const SkImage* image) const;
 
+        /** Function for checking if a rectangle is outside of the current clip.
+
+            Drawing inside a rejected rectangle would not be visible.
+
+            @param pos      position of the rectangle
+            @param size     size of the rectangle
+            @return         true if outside of the clip, otherwise false
+        */
+        [[nodiscard]] bool quickReject(Point pos, Size size) const;
+
+        /** Function for intersecting the current clip with a rectangle.
+
+            @param pos      position of the rectangle
+            @param size     size of the rectangle
+        */
+        void clipRect(Point pos, Size size) const;
+
         /** Function for saving the current matrix and clip on the stack.
 
         */
@@ -0,0 +1,330 @@
+//
+//  core/CommandQueue.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_CORE_COMMANDQUEUE_HPP
+#define PTK_CORE_COMMANDQUEUE_HPP
+
+// pTK Headers
+#include "ptk/util/InplaceFunction.hpp"
+
+// C++ Headers
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace pTK
+{
+    /** CommandQueue class implementation.
+
+        Lock-free multiple producer, single consumer FIFO queue of commands.
+
+        Any thread may push commands, only one thread (the owner) may run them.
+        Commands are stored in intrusive nodes that are pooled and reused, a push
+        does not allocate once the pool has warmed up. Commands that do not fit
+        in the node are stored in a std::function.
+
+        push() reports when the queue transitions from empty to non-empty (from
+        the consumer's point of view), so that the consumer only has to be woken
+        up once per batch of commands.
+    */
+    template <typename Signature, std::size_t Capacity = InplaceFunctionCapacity>
+    class CommandQueue
+    {
+    public:
+        using command_type = InplaceFunction<Signature, Capacity>;
+
+    public:
+        /** Constructs CommandQueue with default values.
+
+            @return     default initialized CommandQueue
+        */
+        CommandQueue() = default;
+
+        /** Destructor for CommandQueue.
+
+            Commands that have not been run are destroyed.
+        */
+        ~CommandQueue()
+        {
+            while (Node* node = pop())
+            {
+                node->command.reset();
+                Release(node, node, 1);
+            }
+        }
+
+        CommandQueue(const CommandQueue&) = delete;
+        CommandQueue(CommandQueue&&) = delete;
+        CommandQueue& operator=(const CommandQueue&) = delete;
+        CommandQueue& operator=(CommandQueue&&) = delete;
+
+        /** Function for adding a command to the end of the queue.
+
+            Note: This function is thread safe.
+
+            @param func     command
+            @return         true if the consumer should be notified, otherwise false
+        */
+        template <typename Func>
+        bool push(Func&& func)
+        {
+            Node* node{Acquire()};
+
+            using type = std::decay_t<Func>;
+            if constexpr ((sizeof(type) <= Capacity) && (alignof(std::max_align_t) % alignof(type) == 0))
+                node->command = std::forward<Func>(func);
+            else
+                node->command = std::function<Signature>{std::forward<Func>(func)};
+
+            // Link the node, the consumer can see it after the store to prev->next.
+            node->next.store(nullptr, std::memory_order_relaxed);
+            Node* prev{m_head.exchange(node, std::memory_order_acq_rel)};
+            prev->next.store(node, std::memory_order_release);
+
+            return !m_signaled.exchange(true, std::memory_order_acq_rel);
+        }
+
+        /** Function for running all the queued commands.
+
+            Commands pushed while running are also run.
+            Note: Must only be called from the consumer thread.
+
+            @param args     function arguments
+            @return         number of commands run
+        */
+        template <typename... Args>
+        std::size_t run(Args&&... args)
+        {
+            // Nodes are returned to the pool in one batch.
+            Node* first{nullptr};
+            Node* last{nullptr};
+            std::size_t count{0};
+
+            // The reset is done after draining, commands pushed while running (that did not
+            // signal) are run here. A push after the reset signals again, the queue is then
+            // checked once more to not miss a push that happened right before the reset.
+            // Exchange (and not store) to not let the load in empty() be done before the reset.
+            do
+            {
+                while (Node* node = pop())
+                {
+                    node->command(args...);
+                    node->command.reset();
+
+                    node->next.store(first, std::memory_order_relaxed);
+                    first = node;
+                    if (last == nullptr)
+                        last = node;
+                    ++count;
+                }
+            } while (m_signaled.exchange(false, std::memory_order_acq_rel) && !empty());
+
+            if (first != nullptr)
+                Release(first, last, count);
+
+            return count;
+        }
+
+        /** Function for checking if the queue is empty.
+
+            Note: Must only be called from the consumer thread and is only a
+                  snapshot, other threads might push at any time.
+
+            @return    status
+        */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            const Node* tail{m_tail};
+            if (tail == &m_stub)
+                tail = tail->next.load(std::memory_order_acquire);
+            return tail == nullptr;
+        }
+
+    private:
+        struct Node
+        {
+            std::atomic<Node*> next{nullptr};
+            command_type command{};
+        };
+
+        // Max number of nodes kept in the pool (approximately).
+        static constexpr std::size_t s_maxPooled{16384};
+
+        // Max number of nodes a thread takes from the pool at once.
+        static constexpr std::size_t s_batchSize{64};
+
+        // Free nodes, shared between all queues of this type.
+        // Consumers push nodes and producers take the whole list at once (and
+        // put back what they do not need), there is no pop of a single node and
+        // therefore no ABA problem.
+        // count includes the nodes that are about to be linked.
+        struct Pool
+        {
+            ~Pool()
+            {
+                Node* node{free.exchange(nullptr, std::memory_order_acquire)};
+                while (node != nullptr)
+                    delete std::exchange(node, node->next.load(std::memory_order_relaxed));
+            }
+
+            std::atomic<Node*> free{nullptr};
+            std::atomic<std::size_t> count{0};
+        };
+
+        // Nodes taken from the pool by the current thread, at most s_batchSize.
+        // The nodes are given back to the pool when the thread exits.
+        struct Cache
+        {
+            ~Cache()
+            {
+                if (head == nullptr)
+                    return;
+
+                Node* last{head};
+                std::size_t count{1};
+                for (; Node* next = last->next.load(std::memory_order_relaxed); ++count)
+                    last = next;
+                Release(head, last, count);
+            }
+
+            Node* head{nullptr};
+        };
+
+        static Pool& GetPool()
+        {
+            static Pool pool{};
+            return pool;
+        }
+
+        static Node* Acquire()
+        {
+            static thread_local Cache cache{};
+
+            if (cache.head == nullptr)
+                cache.head = TakeBatch();
+
+            if (cache.head != nullptr)
+                return std::exchange(cache.head, cache.head->next.load(std::memory_order_relaxed));
+
+            return new Node{};
+        }
+
+        // Takes at most s_batchSize nodes from the pool, the rest is put back
+        // for the other threads.
+        static Node* TakeBatch()
+        {
+            Pool& pool{GetPool()};
+            Node* first{pool.free.exchange(nullptr, std::memory_order_acquire)};
+            if (first == nullptr)
+                return nullptr;
+
+            Node* last{first};
+            std::size_t count{1};
+            while ((count < s_batchSize) && (last->next.load(std::memory_order_relaxed) != nullptr))
+            {
+                last = last->next.load(std::memory_order_relaxed);
+                ++count;
+            }
+
+            Node* rest{last->next.load(std::memory_order_relaxed)};
+            last->next.store(nullptr, std::memory_order_relaxed);
+            pool.count.fetch_sub(count, std::memory_order_relaxed);
+
+            // The pool is most likely still empty, otherwise the end of the rest is needed.
+            Node* expected{nullptr};
+            if ((rest != nullptr) && !pool.free.compare_exchange_strong(expected, rest, std::memory_order_release,
+                                                                        std::memory_order_relaxed))
+            {
+                Node* restLast{rest};
+                while (Node* next = restLast->next.load(std::memory_order_relaxed))
+                    restLast = next;
+                Link(pool, rest, restLast);
+            }
+
+            return first;
+        }
+
+        // Returns count linked nodes first to last to the pool, or deletes
+        // them if the pool is full.
+        static void Release(Node* first, Node* last, std::size_t count)
+        {
+            Pool& pool{GetPool()};
+            if (pool.count.load(std::memory_order_relaxed) + count > s_maxPooled)
+            {
+                last->next.store(nullptr, std::memory_order_relaxed);
+                while (first != nullptr)
+                    delete std::exchange(first, first->next.load(std::memory_order_relaxed));
+                return;
+            }
+
+            pool.count.fetch_add(count, std::memory_order_relaxed);
+            Link(pool, first, last);
+        }
+
+        // Pushes the linked nodes first to last onto the free list of the pool.
+        static void Link(Pool& pool, Node* first, Node* last)
+        {
+            Node* top{pool.free.load(std::memory_order_relaxed)};
+            do
+            {
+                last->next.store(top, std::memory_order_relaxed);
+            } while (!pool.free.compare_exchange_weak(top, first, std::memory_order_release,
+                                                      std::memory_order_relaxed));
+        }
+
+        // Removes the first node in the queue, nullptr if empty or if a
+        // producer is in the middle of linking a node.
+        Node* pop()
+        {
+            Node* tail{m_tail};
+            Node* next{tail->next.load(std::memory_order_acquire)};
+
+            if (tail == &m_stub)
+            {
+                if (next == nullptr)
+                    return nullptr;
+
+                m_tail = next;
+                tail = next;
+                next = next->next.load(std::memory_order_acquire);
+            }
+
+            if (next != nullptr)
+            {
+                m_tail = next;
+                return tail;
+            }
+
+            if (tail != m_head.load(std::memory_order_acquire))
+                return nullptr;
+
+            // Last node, put the stub back so that tail can be removed.
+            m_stub.next.store(nullptr, std::memory_order_relaxed);
+            Node* prev{m_head.exchange(&m_stub, std::memory_order_acq_rel)};
+            prev->next.store(&m_stub, std::memory_order_release);
+
+            next = tail->next.load(std::memory_order_acquire);
+            if (next != nullptr)
+            {
+                m_tail = next;
+                return tail;
+            }
+
+            return nullptr;
+        }
+
+    private:
+        Node m_stub{};
+        std::atomic<Node*> m_head{&m_stub};
+        Node* m_tail{&m_stub};
+        std::atomic<bool> m_signaled{false};
+    };
+} // namespace pTK
+
+#endif // PTK_CORE_COMMANDQUEUE_HPP
@@ -9,6 +9,7 @@
 #define PTK_CORE_CONTEXTBASE_HPP
 
 // pTK Headers
+#include "ptk/core/DamageRegion.hpp"
 #include "ptk/core/Defines.hpp"
 #include "ptk/util/Color.hpp"
 #include "ptk/util/Point.hpp"
@@ -82,8 +83,21 @@ namespace pTK
 
         /** Function for swapping the buffers.
 
+            Contexts that can present parts of the surface should only present
+            the damaged region, others will present the entire surface.
+
+            @param damage   damaged region of the surface (in pixels)
+        */
+        virtual void swapBuffers(const DamageRegion& UNUSED(damage)) {}
+
+        /** Function for checking if the content of the surface is kept after swapBuffers.
+
+            Only contexts that keeps the content can be partially repainted,
+            otherwise the whole surface must be painted every frame.
+
+            @return    status
         */
-        virtual void swapBuffers() {}
+        [[nodiscard]] virtual bool preservesContent() const noexcept { return false; }
 
         /** Function for retrieving the backend type of the context.
 
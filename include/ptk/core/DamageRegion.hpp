@@ -0,0 +1,107 @@
+//
+//  core/DamageRegion.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_CORE_DAMAGEREGION_HPP
+#define PTK_CORE_DAMAGEREGION_HPP
+
+// pTK Headers
+#include "ptk/core/Defines.hpp"
+#include "ptk/util/Rect.hpp"
+
+// C++ Headers
+#include <vector>
+
+namespace pTK
+{
+    /** DamageRegion class implementation.
+
+        Collects the areas that needs to be repainted during a frame.
+        Overlapping rectangles are merged when added and if the region
+        consists of too many rectangles, it will collapse into a single
+        bounding rectangle to keep clipping cheap.
+    */
+    class PTK_API DamageRegion
+    {
+    public:
+        using container_type = std::vector<Rect>;
+        using const_iterator = container_type::const_iterator;
+        using size_type = container_type::size_type;
+
+    public:
+        /** Constructs DamageRegion with default values.
+
+            @return    default initialized DamageRegion
+        */
+        DamageRegion() = default;
+
+        /** Constructs DamageRegion with maxRects.
+
+            @param maxRects     maximum number of rectangles before collapsing
+            @return             initialized DamageRegion
+        */
+        explicit DamageRegion(size_type maxRects);
+
+        /** Function for adding a damaged rectangle to the region.
+
+            Empty rectangles are ignored.
+
+            @param rect     damaged area
+        */
+        void add(const Rect& rect);
+
+        /** Function for removing all damaged areas.
+
+        */
+        void clear() noexcept;
+
+        /** Function for checking if there is no damaged area.
+
+            @return    status
+        */
+        [[nodiscard]] bool empty() const noexcept { return m_rects.empty(); }
+
+        /** Function for retrieving the smallest rectangle that contains the region.
+
+            @return    bounding rectangle
+        */
+        [[nodiscard]] const Rect& bounds() const noexcept { return m_bounds; }
+
+        /** Function for checking if a rectangle overlaps the damaged region.
+
+            @param rect     rectangle to check
+            @return         true if overlapping, otherwise false
+        */
+        [[nodiscard]] bool intersects(const Rect& rect) const noexcept;
+
+        /** Function for retrieving the current amount of rectangles in the region.
+
+            @return     number of rectangles
+        */
+        [[nodiscard]] size_type count() const noexcept { return m_rects.size(); }
+
+        /** Function for retrieving the an iterator that points to the first
+            rectangle in the region.
+
+            @return    const iterator
+        */
+        [[nodiscard]] const_iterator begin() const noexcept { return m_rects.cbegin(); }
+
+        /** Function for retrieving the special iterator referring to
+            the past-the-end of the region.
+
+            @return    const iterator
+        */
+        [[nodiscard]] const_iterator end() const noexcept { return m_rects.cend(); }
+
+    private:
+        container_type m_rects{};
+        Rect m_bounds{};
+        size_type m_maxRects{8};
+    };
+} // namespace pTK
+
+#endif // PTK_CORE_DAMAGEREGION_HPP
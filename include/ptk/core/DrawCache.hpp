@@ -0,0 +1,139 @@
+//
+//  core/DrawCache.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_CORE_DRAWCACHE_HPP
+#define PTK_CORE_DRAWCACHE_HPP
+
+// pTK Headers
+#include "ptk/core/Defines.hpp"
+#include "ptk/util/Rect.hpp"
+#include "ptk/util/Vec2.hpp"
+
+// C++ Headers
+#include <cstdint>
+
+// Skia Headers
+PTK_DISABLE_WARN_BEGIN()
+#include "include/core/SkRefCnt.h"
+PTK_DISABLE_WARN_END()
+
+// Skia Forward Declarations
+class SkImage;
+class SkPicture;
+
+namespace pTK
+{
+    // Forward Declarations
+    class Canvas;
+    class Drawable;
+
+    /** CachePolicy enum class implementation.
+
+        Specifies how the drawing of a Widget is cached.
+            - None: drawn every time.
+            - Picture: drawing commands are recorded and replayed.
+            - Raster: drawing is rendered to an image that is drawn instead.
+    */
+    enum class CachePolicy : uint8_t
+    {
+        None = 0,
+        Picture,
+        Raster
+    };
+
+    /** DrawCache class implementation.
+
+        Caches the result of Drawable::onDraw and replays it until the cache
+        is invalidated or the bounds (or scale for Raster) have changed.
+    */
+    class PTK_API DrawCache
+    {
+    public:
+        // Number of draws that were replayed (hits) and recorded (misses).
+        struct Stats
+        {
+            uint64_t hits{0};
+            uint64_t misses{0};
+        };
+
+    public:
+        /** Constructs DrawCache with policy.
+
+            @param policy   how to cache
+            @return         initialized DrawCache
+        */
+        explicit DrawCache(CachePolicy policy) noexcept;
+
+        /** Destructor for DrawCache.
+
+        */
+        ~DrawCache();
+
+        /** Deleted Copy Constructor.
+
+        */
+        DrawCache(const DrawCache&) = delete;
+
+        /** Deleted Copy Assignment operator.
+
+        */
+        DrawCache& operator=(const DrawCache&) = delete;
+
+        /** Function for drawing from the cache.
+
+            The drawable is only drawn (and recorded) if the cache is not valid.
+
+            @param canvas       valid Canvas pointer to draw to
+            @param bounds       area the drawable draws in (in canvas coordinates)
+            @param drawable     content to cache
+        */
+        void draw(Canvas* canvas, const Rect& bounds, Drawable& drawable);
+
+        /** Function for marking the cache as outdated.
+
+        */
+        void invalidate() noexcept { m_valid = false; }
+
+        /** Function for checking if the cache can be replayed.
+
+            @return    status
+        */
+        [[nodiscard]] bool valid() const noexcept { return m_valid; }
+
+        /** Function for retrieving how the drawing is cached.
+
+            @return    policy
+        */
+        [[nodiscard]] CachePolicy policy() const noexcept { return m_policy; }
+
+        /** Function for retrieving the hit and miss counters.
+
+            @return    counters
+        */
+        [[nodiscard]] const Stats& stats() const noexcept { return m_stats; }
+
+        /** Function for resetting the hit and miss counters.
+
+        */
+        void resetStats() noexcept { m_stats = {}; }
+
+    private:
+        [[nodiscard]] bool record(Canvas* canvas, const Rect& bounds, Drawable& drawable);
+        void replay(Canvas* canvas) const;
+
+    private:
+        sk_sp<SkPicture> m_picture{};
+        sk_sp<SkImage> m_image{};
+        Rect m_bounds{};
+        Vec2f m_scale{1.0f, 1.0f};
+        Stats m_stats{};
+        CachePolicy m_policy;
+        bool m_valid{false};
+    };
+} // namespace pTK
+
+#endif // PTK_CORE_DRAWCACHE_HPP
@@ -14,6 +14,11 @@
 #include "ptk/events/KeyEvent.hpp"
 #include "ptk/events/MouseEvent.hpp"
 #include "ptk/events/WidgetEvents.hpp"
+#include "ptk/util/InplaceFunction.hpp"
+
+// C++ Headers
+#include <type_traits>
+#include <utility>
 
 namespace pTK
 {
@@ -38,6 +43,10 @@ namespace pTK
         pointers of type bool() or bool(const T&) since the return value
         serves a purpose for deletion.
 
+        Callbacks are stored inline (see InplaceFunction) and must fit in
+        InplaceFunctionCapacity bytes, typical lambdas capturing a few
+        pointers do not allocate.
+
         The addListener function can be used to add a callback to any type.
         When a callback has been added a unique identifier will be returned.
 
@@ -81,22 +90,20 @@ namespace pTK
             @param callback     function to call on event
             @return             callback id
         */
-        template <typename T>
-        uint64_t addListener(const std::function<bool(const T&)>& callback)
+        template <typename T, typename Callback>
+        uint64_t addListener(Callback&& callback)
         {
-            return m_callbackStorage.addCallback<T, bool(const T&)>(callback);
-        }
-
-        /** Function to add callback.
-
-            @param callback     function to call on event
-            @return             callback id
-        */
-        template <typename T>
-        uint64_t addListener(const std::function<bool()>& callback)
-        {
-            auto helper_func = [callback](const T&) { return callback(); };
-            return m_callbackStorage.addCallback<T, bool(const T&)>(helper_func);
+            if constexpr (std::is_invocable_r_v<bool, std::decay_t<Callback>&, const T&>)
+                return m_callbackStorage.addCallback<T, bool(const T&)>(std::forward<Callback>(callback));
+            else
+            {
+                static_assert(std::is_invocable_r_v<bool, std::decay_t<Callback>&>,
+                              "Callback must be callable as bool(const T&) or bool()");
+
+                // Event is discarded, the callback is stored in the helper without another wrapper.
+                auto helper_func = [func = std::forward<Callback>(callback)](const T&) mutable { return func(); };
+                return m_callbackStorage.addCallback<T, bool(const T&)>(std::move(helper_func));
+            }
         }
 
         /** Function to remove callback.
@@ -111,6 +118,10 @@ namespace pTK
 
         /** Function to trigger an event.
 
+            Listeners may add or remove listeners (including themselves)
+            and trigger events while the event is dispatched. Listeners added
+            during the dispatch are first called on the next event.
+
             @param event    triggered event
         */
         template <typename T, typename... Args>
@@ -218,63 +229,63 @@ namespace pTK
             @param callback    function to call on key event
             @return            callback id
         */
-        uint64_t onKey(const std::function<bool(const KeyEvent&)>& callback);
+        uint64_t onKey(InplaceFunction<bool(const KeyEvent&)> callback);
 
         /** Function for handling when key input
 
             @param callback    function to call on key input
             @return            callback id
         */
-        uint64_t onInput(const std::function<bool(const InputEvent&)>& callback);
+        uint64_t onInput(InplaceFunction<bool(const InputEvent&)> callback);
 
         /** Function for handling when mouse is hovering.
 
             @param callback    function to call on hover event
             @return            callback id
         */
-        uint64_t onHover(const std::function<bool(const MotionEvent&)>& callback);
+        uint64_t onHover(InplaceFunction<bool(const MotionEvent&)> callback);
 
         /** Function for handling when mouse is entering.
 
             @param callback    function to call on hover event
             @return            callback id
         */
-        uint64_t onEnter(const std::function<bool(const EnterEvent&)>& callback);
+        uint64_t onEnter(InplaceFunction<bool(const EnterEvent&)> callback);
 
         /** Function for handling when mouse is leaving.
 
             @param callback    function to call on leaving event
             @return            callback id
         */
-        uint64_t onLeave(const std::function<bool(const LeaveEvent&)>& callback);
+        uint64_t onLeave(InplaceFunction<bool(const LeaveEvent&)> callback);
 
         /** Function for handling when mouse has left and a previous click has happened.
 
             @param callback    function to call
             @return            callback id
         */
-        uint64_t onLeaveClick(const std::function<bool(const LeaveClickEvent&)>& callback);
+        uint64_t onLeaveClick(InplaceFunction<bool(const LeaveClickEvent&)> callback);
 
         /** Function for handling when mouse is scrolling.
 
             @param callback    function to call
             @return            callback id
         */
-        uint64_t onScroll(const std::function<bool(const ScrollEvent&)>& callback);
+        uint64_t onScroll(InplaceFunction<bool(const ScrollEvent&)> callback);
 
         /** Function for handling when mouse is clicking.
 
             @param callback    function to call
             @return            callback id
         */
-        uint64_t onClick(const std::function<bool(const ClickEvent&)>& callback);
+        uint64_t onClick(InplaceFunction<bool(const ClickEvent&)> callback);
 
         /** Function for handling when mouse is released.
 
             @param callback    function to call
             @return            callback id
         */
-        uint64_t onRelease(const std::function<bool(const ReleaseEvent&)>& callback);
+        uint64_t onRelease(InplaceFunction<bool(const ReleaseEvent&)> callback);
     };
 } // namespace pTK
 
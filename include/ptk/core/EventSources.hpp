@@ -0,0 +1,164 @@
+//
+//  core/EventSources.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_CORE_EVENTSOURCES_HPP
+#define PTK_CORE_EVENTSOURCES_HPP
+
+// pTK Headers
+#include "ptk/core/Defines.hpp"
+#include "ptk/util/InplaceFunction.hpp"
+
+// C++ Headers
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace pTK
+{
+    /** EventSources class implementation.
+
+        Timers and file descriptor watchers that are run on the thread
+        running the Application event loop.
+
+        Timers use a monotonic clock and are kept in a min-heap by deadline.
+        File descriptors are waited on by the platform together with its own
+        events, ready descriptors are reported back with dispatchWatch().
+
+        Note: Not thread safe, use it from the event loop thread only.
+        Callbacks may add and remove timers and watchers (including themselves).
+    */
+    class PTK_API EventSources
+    {
+    public:
+        using clock_type = std::chrono::steady_clock;
+        using time_point = clock_type::time_point;
+        using id_type = uint64_t;
+        using timer_callback = InplaceFunction<void()>;
+        using watch_callback = InplaceFunction<void(int, uint32_t)>;
+
+        // Watch event flags.
+        static constexpr uint32_t Readable{1u << 0};
+        static constexpr uint32_t Writable{1u << 1};
+        static constexpr uint32_t Error{1u << 2};
+        static constexpr uint32_t Invalid{1u << 3}; // The fd is not open (reported with Error).
+
+        struct Watch
+        {
+            id_type id;
+            int fd;
+            uint32_t events;
+            watch_callback callback;
+        };
+
+    public:
+        /** Constructs EventSources with default values.
+
+            @return    default initialized EventSources
+        */
+        EventSources() = default;
+
+        /** Function for adding a timer.
+
+            A repeating timer is run every interval after the first run.
+
+            @param delay        time until the timer runs
+            @param callback     function to call
+            @param repeat       true if the timer should repeat
+            @param now          current time
+            @return             timer id
+        */
+        id_type addTimer(std::chrono::milliseconds delay, timer_callback callback, bool repeat = false,
+                         time_point now = clock_type::now());
+
+        /** Function for removing a timer.
+
+            @param id   timer id
+            @return     true if removed, otherwise false
+        */
+        bool removeTimer(id_type id);
+
+        /** Function for running all the timers that are due.
+
+            Timers added while running are not run until the next call.
+
+            @param now      current time
+            @return         number of timers run
+        */
+        std::size_t dispatchTimers(time_point now = clock_type::now());
+
+        /** Function for retrieving the time to wait for the next timer.
+
+            @param allowed  max time to wait in ms, negative for indefinitely
+            @param now      current time
+            @return         time to wait in ms, negative for indefinitely
+        */
+        [[nodiscard]] int timeout(int allowed, time_point now = clock_type::now()) const;
+
+        /** Function for retrieving the number of timers.
+
+            @return     number of timers
+        */
+        [[nodiscard]] std::size_t timerCount() const noexcept { return m_timers.size(); }
+
+        /** Function for adding a file descriptor watcher.
+
+            @param fd           file descriptor
+            @param events       Readable and/or Writable
+            @param callback     function to call with the fd and the ready events
+            @return             watcher id
+        */
+        id_type addWatch(int fd, uint32_t events, watch_callback callback);
+
+        /** Function for removing a file descriptor watcher.
+
+            @param id   watcher id
+            @return     true if removed, otherwise false
+        */
+        bool removeWatch(id_type id);
+
+        /** Function for calling a watcher with the ready events.
+
+            Nothing happens if the watcher has been removed.
+            The watcher is removed after the call if ready contains Invalid,
+            since an fd that is not open would be reported on every wait.
+
+            @param id       watcher id
+            @param ready    ready events
+            @return         true if called, otherwise false
+        */
+        bool dispatchWatch(id_type id, uint32_t ready);
+
+        /** Function for retrieving the file descriptor watchers.
+
+            @return     watchers
+        */
+        [[nodiscard]] const std::vector<Watch>& watches() const noexcept { return m_watches; }
+
+    private:
+        struct Timer
+        {
+            time_point deadline;
+            clock_type::duration interval;
+            id_type id;
+            bool repeat;
+            timer_callback callback;
+        };
+
+        // Heap ordering, earliest deadline at the front.
+        static bool Later(const Timer& lhs, const Timer& rhs) noexcept;
+
+        void pushTimer(Timer&& timer);
+
+    private:
+        std::vector<Timer> m_timers{};
+        std::vector<Timer> m_due{};
+        std::vector<Watch> m_watches{};
+        id_type m_nextId{1};
+    };
+} // namespace pTK
+
+#endif // PTK_CORE_EVENTSOURCES_HPP
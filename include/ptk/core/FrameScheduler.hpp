@@ -0,0 +1,130 @@
+//
+//  core/FrameScheduler.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_CORE_FRAMESCHEDULER_HPP
+#define PTK_CORE_FRAMESCHEDULER_HPP
+
+// pTK Headers
+#include "ptk/core/Defines.hpp"
+
+// C++ Headers
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+namespace pTK
+{
+    /** FrameScheduler class implementation.
+
+        Keeps the frame deadlines of a window in nanoseconds, aligned to the
+        refresh interval of the monitor. All invalidations before a deadline
+        result in a single frame at that deadline.
+
+        When the window has been idle for more than an interval, the next frame
+        is drawn directly and the deadlines are aligned to it.
+
+        Also keeps statistics of the time it takes to produce a frame and the
+        number of frames that missed their deadline.
+    */
+    class PTK_API FrameScheduler
+    {
+    public:
+        using clock_type = std::chrono::steady_clock;
+        using time_point = clock_type::time_point;
+        using duration = std::chrono::nanoseconds;
+
+        struct Stats
+        {
+            std::size_t frames{0};
+            std::size_t missed{0};
+            duration p50{0};
+            duration p99{0};
+        };
+
+        // Number of frame times kept for the percentiles.
+        static constexpr std::size_t SampleCount{256};
+
+    public:
+        /** Constructs FrameScheduler with refresh rate.
+
+            @param refreshRate  refresh rate in Hz
+            @return             initialized FrameScheduler
+        */
+        explicit FrameScheduler(double refreshRate = 60.0) noexcept;
+
+        /** Function for setting the refresh rate.
+
+            Non-positive values fall back to 60 Hz.
+
+            @param refreshRate  refresh rate in Hz
+        */
+        void setRefreshRate(double refreshRate) noexcept;
+
+        /** Function for retrieving the refresh rate.
+
+            @return     refresh rate in Hz
+        */
+        [[nodiscard]] double refreshRate() const noexcept { return m_refreshRate; }
+
+        /** Function for retrieving the frame interval.
+
+            @return     time between frames
+        */
+        [[nodiscard]] duration interval() const noexcept { return m_interval; }
+
+        /** Function for retrieving the deadline of the next frame.
+
+            The frame should be drawn when the deadline has been reached.
+
+            @return     deadline of the next frame
+        */
+        [[nodiscard]] time_point deadline() const noexcept { return m_nextDeadline; }
+
+        /** Function for retrieving the time left until the next frame.
+
+            @param now  current time
+            @return     time until the deadline, zero if it has been reached
+        */
+        [[nodiscard]] duration timeUntilFrame(time_point now = clock_type::now()) const noexcept;
+
+        /** Function for marking the start of a frame.
+
+            @param now  current time
+        */
+        void beginFrame(time_point now = clock_type::now()) noexcept;
+
+        /** Function for marking the end of a frame (when it has been presented).
+
+            @param now  current time
+        */
+        void endFrame(time_point now = clock_type::now()) noexcept;
+
+        /** Function for retrieving the frame statistics.
+
+            @return     frame statistics
+        */
+        [[nodiscard]] Stats stats() const;
+
+        /** Function for clearing the frame statistics.
+
+        */
+        void resetStats() noexcept;
+
+    private:
+        std::array<duration, SampleCount> m_samples{};
+        std::size_t m_sampleIndex{0};
+        std::size_t m_frames{0};
+        std::size_t m_missed{0};
+        time_point m_nextDeadline{};
+        time_point m_frameDeadline{};
+        time_point m_frameStart{};
+        duration m_interval{};
+        double m_refreshRate{60.0};
+    };
+} // namespace pTK
+
+#endif // PTK_CORE_FRAMESCHEDULER_HPP
@@ -0,0 +1,141 @@
+//
+//  core/Profiler.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_CORE_PROFILER_HPP
+#define PTK_CORE_PROFILER_HPP
+
+// pTK Headers
+#include "ptk/core/Defines.hpp"
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+
+namespace pTK
+{
+    /** Profiler class implementation.
+
+        Collects timed zones in a ring buffer per thread. Recording a zone is
+        lock-free and does not allocate, the buffer of a thread is allocated
+        the first time the thread records a zone.
+
+        The zones can be exported in the Chrome trace event format, which can be
+        opened in chrome://tracing or Perfetto.
+
+        The PTK_PROFILE_ZONE macros are compiled out unless PTK_PROFILE is defined.
+    */
+    class PTK_API Profiler
+    {
+    public:
+        // Number of zones kept per thread, older zones are overwritten.
+        static constexpr std::size_t BufferSize{1 << 14};
+
+        /** Function for recording a zone.
+
+            Note: The name must outlive the profiler (a string literal).
+
+            @param name     name of the zone
+            @param begin    start time in ns
+            @param end      end time in ns
+            @param mangled  true if name is a mangled type name (from std::type_info)
+        */
+        static void Record(const char* name, int64_t begin, int64_t end, bool mangled = false) noexcept;
+
+        /** Function for retrieving the current time used by the zones.
+
+            @return     monotonic time in ns
+        */
+        [[nodiscard]] static int64_t Now() noexcept;
+
+        /** Function for writing the recorded zones as a Chrome trace.
+
+            Zones recorded while writing might be missing.
+
+            @param stream   stream to write to
+        */
+        static void WriteChromeTrace(std::ostream& stream);
+
+        /** Function for writing the recorded zones as a Chrome trace to a file.
+
+            @param path     file path
+            @return         true if written, otherwise false
+        */
+        static bool WriteChromeTrace(const std::string& path);
+
+        /** Function for removing all the recorded zones.
+
+            Note: Zones recorded while clearing might be kept.
+        */
+        static void Clear() noexcept;
+    };
+
+    /** ProfileZone class implementation.
+
+        Records a zone from construction to destruction.
+    */
+    class ProfileZone
+    {
+    public:
+        /** Constructs ProfileZone with name.
+
+            @param name     name of the zone (a string literal)
+            @return         initialized ProfileZone
+        */
+        explicit ProfileZone(const char* name) noexcept
+            : m_name{name},
+              m_begin{Profiler::Now()}
+        {}
+
+        /** Constructs ProfileZone with type.
+
+            The zone is named after the type (demangled when exported).
+
+            @param type     type information
+            @return         initialized ProfileZone
+        */
+        explicit ProfileZone(const std::type_info& type) noexcept
+            : m_name{type.name()},
+              m_begin{Profiler::Now()},
+              m_mangled{true}
+        {}
+
+        /** Destructor for ProfileZone.
+
+        */
+        ~ProfileZone() { Profiler::Record(m_name, m_begin, Profiler::Now(), m_mangled); }
+
+        ProfileZone(const ProfileZone&) = delete;
+        ProfileZone& operator=(const ProfileZone&) = delete;
+
+    private:
+        const char* m_name;
+        int64_t m_begin;
+        bool m_mangled{false};
+    };
+} // namespace pTK
+
+// clang-format off
+
+#define PTK_PROFILE_CONCAT_IMPL(x, y) x##y
+#define PTK_PROFILE_CONCAT(x, y) PTK_PROFILE_CONCAT_IMPL(x, y)
+
+#ifdef PTK_PROFILE
+    #define PTK_PROFILE_ZONE(name) const pTK::ProfileZone PTK_PROFILE_CONCAT(ptkProfileZone, __LINE__){name}
+    #define PTK_PROFILE_ZONE_TYPE(type) const pTK::ProfileZone PTK_PROFILE_CONCAT(ptkProfileZone, __LINE__){type}
+    #define PTK_PROFILE_FUNCTION() PTK_PROFILE_ZONE(__func__)
+#else
+    #define PTK_PROFILE_ZONE(name)
+    #define PTK_PROFILE_ZONE_TYPE(type)
+    #define PTK_PROFILE_FUNCTION()
+#endif
+
+// clang-format on
+
+#endif // PTK_CORE_PROFILER_HPP
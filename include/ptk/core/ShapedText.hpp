@@ -0,0 +1,95 @@
+//
+//  core/ShapedText.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_CORE_SHAPEDTEXT_HPP
+#define PTK_CORE_SHAPEDTEXT_HPP
+
+// pTK Headers
+#include "ptk/core/Defines.hpp"
+#include "ptk/util/Vec2.hpp"
+
+// Skia Headers
+PTK_DISABLE_WARN_BEGIN()
+#include "include/core/SkFont.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkTextBlob.h"
+PTK_DISABLE_WARN_END()
+
+// C++ Headers
+#include <cstddef>
+
+namespace pTK
+{
+    /** ShapedText class implementation.
+
+        A line of text converted to glyphs with a font, ready to be drawn.
+        Shaping (glyph lookup and measuring) is done once on construction,
+        drawing the blob afterwards does no text work.
+
+        Note: Has to be rebuilt when the text or the font changes.
+    */
+    class PTK_API ShapedText
+    {
+    public:
+        /** Constructs ShapedText with default values.
+
+            @return    default initialized (empty) ShapedText
+        */
+        ShapedText() = default;
+
+        /** Constructs ShapedText with text and font.
+
+            @param text         pointer to the text
+            @param byteLength   size of the text in bytes
+            @param encoding     encoding of the text
+            @param font         font to shape with
+            @return             initialized ShapedText
+        */
+        ShapedText(const void* text, std::size_t byteLength, SkTextEncoding encoding, const SkFont& font);
+
+        /** Function for retrieving the glyph blob.
+
+            @return    blob, nullptr if empty
+        */
+        [[nodiscard]] const sk_sp<SkTextBlob>& blob() const noexcept { return m_blob; }
+
+        /** Function for retrieving the advance (width including spacing).
+
+            @return    advance
+        */
+        [[nodiscard]] float advance() const noexcept { return m_advance; }
+
+        /** Function for retrieving the size of the ink bounds.
+
+            @return    width and height of the bounds
+        */
+        [[nodiscard]] const Vec2f& bounds() const noexcept { return m_bounds; }
+
+        /** Function for retrieving the offset from the draw position to the blob origin.
+
+            Leading spaces are kept and the left side bearing of the first glyph
+            is removed, the baseline is placed at the cap height.
+
+            @return    offset
+        */
+        [[nodiscard]] const Vec2f& offset() const noexcept { return m_offset; }
+
+        /** Function for checking if there is anything to draw.
+
+            @return    true if empty, otherwise false
+        */
+        [[nodiscard]] bool empty() const noexcept { return !m_blob; }
+
+    private:
+        sk_sp<SkTextBlob> m_blob{};
+        Vec2f m_bounds{0.0f, 0.0f};
+        Vec2f m_offset{0.0f, 0.0f};
+        float m_advance{0.0f};
+    };
+} // namespace pTK
+
+#endif // PTK_CORE_SHAPEDTEXT_HPP
@@ -0,0 +1,144 @@
+//
+//  core/SpatialIndex.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_CORE_SPATIALINDEX_HPP
+#define PTK_CORE_SPATIALINDEX_HPP
+
+// pTK Headers
+#include "ptk/core/Defines.hpp"
+#include "ptk/util/Rect.hpp"
+
+// C++ Headers
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace pTK
+{
+    /** SpatialIndex class implementation.
+
+        Acceleration structure for finding which rectangle contains a point.
+        Each rectangle is identified by its index in the vector it was built from,
+        if multiple rectangles contain the point, the lowest index is returned.
+
+        Available structures:
+            - Horizontal: rectangles sorted by x position (binary search).
+            - Vertical: rectangles sorted by y position (binary search).
+            - Grid: uniform grid of buckets, for rectangles without ordering.
+
+        Horizontal and Vertical are intended for rectangles that are laid out
+        next to each other along an axis (as in a BoxLayout), overlapping
+        rectangles are supported but will make lookups slower.
+    */
+    class PTK_API SpatialIndex
+    {
+    public:
+        using size_type = std::size_t;
+
+        /** Type enum class.
+
+            Specifies which structure to use.
+        */
+        enum class Type : uint8_t
+        {
+            None = 0,
+            Horizontal,
+            Vertical,
+            Grid
+        };
+
+        // Returned when no rectangle contains the point.
+        static constexpr size_type npos{std::numeric_limits<size_type>::max()};
+
+    public:
+        /** Constructs SpatialIndex with default values.
+
+            @return    default initialized SpatialIndex
+        */
+        SpatialIndex() = default;
+
+        /** Constructs SpatialIndex with type.
+
+            @param type     structure to use
+            @return         initialized SpatialIndex
+        */
+        explicit SpatialIndex(Type type) noexcept
+            : m_type{type}
+        {}
+
+        /** Function for building the index from rectangles.
+
+            @param rects    rectangles to index
+        */
+        void build(const std::vector<Rect>& rects);
+
+        /** Function for marking the index as outdated.
+
+            The index must be built again before it can be used.
+        */
+        void invalidate() noexcept { m_valid = false; }
+
+        /** Function for checking if the index is up to date.
+
+            @return    status
+        */
+        [[nodiscard]] bool valid() const noexcept { return m_valid; }
+
+        /** Function for retrieving the structure in use.
+
+            @return    type
+        */
+        [[nodiscard]] Type type() const noexcept { return m_type; }
+
+        /** Function for changing the structure in use.
+
+            Will invalidate the index if the type is changed.
+
+            @param type     structure to use
+        */
+        void setType(Type type) noexcept;
+
+        /** Function for finding the rectangle that contains the point.
+
+            @param pos      point to search for
+            @return         index of the rectangle or npos
+        */
+        [[nodiscard]] size_type find(const Point& pos) const;
+
+    private:
+        [[nodiscard]] size_type findOnAxis(const Point& pos) const;
+        [[nodiscard]] size_type findInGrid(const Point& pos) const;
+        void buildAxis(const std::vector<Rect>& rects);
+        void buildGrid(const std::vector<Rect>& rects);
+
+    private:
+        struct Entry
+        {
+            Rect rect{};
+            size_type index{0};
+        };
+
+        // Sorted by start position on the axis (Horizontal & Vertical),
+        // or by cell (Grid).
+        std::vector<Entry> m_entries{};
+
+        // Axis: largest end position among entries [0, i].
+        std::vector<int64_t> m_maxEnd{};
+
+        // Grid: m_entries[m_cells[c], m_cells[c + 1]) are in cell c.
+        std::vector<size_type> m_cells{};
+        Rect m_bounds{};
+        Size m_cellSize{};
+        size_type m_columns{0};
+        size_type m_rows{0};
+
+        Type m_type{Type::None};
+        bool m_valid{false};
+    };
+} // namespace pTK
+
+#endif // PTK_CORE_SPATIALINDEX_HPP
@@ -9,6 +9,7 @@
 #define PTK_CORE_TEXT_HPP
 
 // pTK Headers
+#include "ptk/core/ShapedText.hpp"
 #include "ptk/util/Color.hpp"
 #include "ptk/util/Size.hpp"
 #include "ptk/util/Vec2.hpp"
@@ -105,12 +106,45 @@ namespace pTK
         */
         [[nodiscard]] Vec2f getBoundsFromStr(const std::string& str) const;
 
+        /** Function for shaping a string with the current font.
+
+            @param  str     string to shape
+            @return         shaped str
+        */
+        [[nodiscard]] ShapedText shapeStr(const std::string& str) const;
+
+        /** Function for retrieving the cached shaped text.
+
+            Rebuilt with updateShapedText, which should be done in onTextUpdate
+            (called when the text or the font changes).
+
+            @return  shaped text
+        */
+        [[nodiscard]] const ShapedText& shapedText() const;
+
+        /** Function for measuring the advance of each byte of UTF-8 text.
+
+            The advance of a char is stored on its first byte, the other bytes
+            have an advance of zero. Invalid sequences have the advance of U+FFFD.
+
+            @param font         font to measure with
+            @param text         UTF-8 text
+            @param size         number of bytes in text
+            @param advances     advances of the bytes (size elements)
+            @return             sum of the advances
+        */
+        static float MeasureAdvances(const SkFont& font, const char* text, std::size_t size, float* advances);
+
         /** Function for retrieving the raw SkFont.
 
             @return  raw SkFont
          */
         [[nodiscard]] const SkFont& skFont() const;
 
+    protected:
+        // Shapes str and caches it as the shaped text.
+        void updateShapedText(const std::string& str);
+
     private:
         // Callback for when the text updates.
         virtual void onTextUpdate() {}
@@ -120,6 +154,7 @@ namespace pTK
 
     private:
         SkFont m_font;
+        ShapedText m_shapedText{};
         float m_capHeight{0.0f};
         float m_ascentToDescent{0.0f};
     };
@@ -0,0 +1,189 @@
+//
+//  core/TextLayout.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_CORE_TEXTLAYOUT_HPP
+#define PTK_CORE_TEXTLAYOUT_HPP
+
+// pTK Headers
+#include "ptk/core/Defines.hpp"
+
+// Skia Headers
+PTK_DISABLE_WARN_BEGIN()
+#include "include/core/SkFont.h"
+PTK_DISABLE_WARN_END()
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pTK
+{
+    /** TextLayout class implementation.
+
+        Breaks UTF-8 text into lines that fit a width. Paragraphs are separated
+        by '\n' and broken greedily at spaces, words wider than the width are
+        broken between chars.
+
+        The line breaks are cached per paragraph. When the width changes, a
+        paragraph is only broken again from its first line that would change,
+        paragraphs that fit on one line are not measured again.
+    */
+    class PTK_API TextLayout
+    {
+    public:
+        // Line of text, bytes [start, end) of the text (without trailing spaces).
+        struct Line
+        {
+            std::size_t start{0};
+            std::size_t end{0};
+            float width{0.0f};
+        };
+
+    public:
+        /** Constructs TextLayout with default values.
+
+            @return    default initialized TextLayout (no wrapping)
+        */
+        TextLayout() = default;
+
+        /** Function for setting the text.
+
+            @param text     UTF-8 text
+        */
+        void setText(std::string text);
+
+        /** Function for retrieving the text.
+
+            @return    text
+        */
+        [[nodiscard]] const std::string& text() const noexcept { return m_text; }
+
+        /** Function for setting the font, the text is laid out again.
+
+            @param font     font to measure with
+        */
+        void setFont(const SkFont& font);
+
+        /** Function for setting the max width of the lines.
+
+            @param width    max width, infinity for no wrapping
+        */
+        void setWidth(float width);
+
+        /** Function for retrieving the max width of the lines.
+
+            @return    max width
+        */
+        [[nodiscard]] float width() const noexcept { return m_width; }
+
+        /** Function for retrieving the number of lines.
+
+            @return    number of lines
+        */
+        [[nodiscard]] std::size_t lineCount() const noexcept { return m_firstLine.back(); }
+
+        /** Function for retrieving a line.
+
+            @param index    line index (< lineCount())
+            @return         line
+        */
+        [[nodiscard]] Line line(std::size_t index) const;
+
+        /** Function for retrieving the lines inside a vertical range.
+
+            @param top      top of the range
+            @param bottom   bottom of the range
+            @return         first and last (exclusive) line index
+        */
+        [[nodiscard]] std::pair<std::size_t, std::size_t> linesBetween(float top, float bottom) const;
+
+        /** Function for retrieving the height of a line.
+
+            @return    line height
+        */
+        [[nodiscard]] float lineHeight() const noexcept { return m_lineHeight; }
+
+        /** Function for retrieving the distance from the top of a line to the baseline.
+
+            @return    ascent
+        */
+        [[nodiscard]] float ascent() const noexcept { return m_ascent; }
+
+        /** Function for retrieving the height of all lines.
+
+            @return    height
+        */
+        [[nodiscard]] float height() const noexcept { return static_cast<float>(lineCount()) * m_lineHeight; }
+
+        /** Function for retrieving the width of the widest line.
+
+            @return    width
+        */
+        [[nodiscard]] float maxLineWidth() const noexcept { return m_maxLineWidth; }
+
+        /** Function for retrieving the number of lines broken by the last update.
+
+            Lines of paragraphs that fit on one line are not counted.
+
+            @return    number of lines
+        */
+        [[nodiscard]] std::size_t brokenLines() const noexcept { return m_brokenLines; }
+
+    private:
+        // Word followed by spaces, offsets are relative to the paragraph.
+        struct Segment
+        {
+            uint32_t wordEnd;
+            uint32_t end;
+            float advance;      // Advance of the word.
+            float spaceAdvance; // Advance of the spaces.
+        };
+
+        // Broken line, offsets are relative to the paragraph.
+        struct BrokenLine
+        {
+            uint32_t start;
+            uint32_t end;
+            uint32_t segment; // Segment the line starts in.
+            float width;
+            float fit; // Min width for the line to fit more, unchanged while width <= max width < fit.
+        };
+
+        struct Paragraph
+        {
+            std::size_t start;
+            std::size_t end;
+            float naturalWidth; // Width without wrapping.
+            float maxLineWidth;
+            std::vector<Segment> segments; // Measured when the paragraph is broken.
+            std::vector<BrokenLine> lines; // Empty if the paragraph fits on one line.
+        };
+
+        void layout();
+        void measureSegments(Paragraph& paragraph);
+        void breakLines(Paragraph& paragraph, std::size_t first);
+        void updateLines();
+
+    private:
+        std::string m_text{};
+        SkFont m_font{};
+        std::vector<Paragraph> m_paragraphs{};
+        std::vector<std::size_t> m_firstLine{0}; // First line of each paragraph (and total number of lines).
+        std::vector<float> m_advances{};          // Scratch buffer for char advances.
+        float m_width{std::numeric_limits<float>::infinity()};
+        float m_lineHeight{0.0f};
+        float m_ascent{0.0f};
+        float m_maxLineWidth{0.0f};
+        std::size_t m_brokenLines{0};
+    };
+} // namespace pTK
+
+#endif // PTK_CORE_TEXTLAYOUT_HPP
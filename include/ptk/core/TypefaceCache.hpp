@@ -0,0 +1,96 @@
+//
+//  core/TypefaceCache.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_CORE_TYPEFACECACHE_HPP
+#define PTK_CORE_TYPEFACECACHE_HPP
+
+// pTK Headers
+#include "ptk/core/Defines.hpp"
+
+// Skia Headers
+PTK_DISABLE_WARN_BEGIN()
+#include "include/core/SkFontStyle.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkTypeface.h"
+PTK_DISABLE_WARN_END()
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pTK
+{
+    /** TypefaceCache class implementation.
+
+        Process-wide cache of typefaces, shared by all Text instances.
+        A family (with style) or font file is only loaded once, later
+        lookups return the same typeface. Functions are thread-safe.
+
+        Typefaces are kept until Clear is called.
+    */
+    class PTK_API TypefaceCache
+    {
+    public:
+        // Cache and Skia glyph cache usage.
+        struct Stats
+        {
+            std::size_t typefaces{0};       // Number of cached typefaces.
+            uint64_t hits{0};               // Lookups served from the cache.
+            uint64_t misses{0};             // Lookups that loaded a typeface.
+            std::size_t glyphCacheUsed{0};  // Bytes used by the glyph cache.
+            std::size_t glyphCacheLimit{0}; // Max bytes of the glyph cache.
+            int glyphCacheCount{0};         // Number of glyph caches (font and size pairs).
+        };
+
+    public:
+        /** Function for retrieving a typeface from a family name.
+
+            @param family   family name, empty for the default family
+            @param style    style of the typeface
+            @return         typeface, might be a fallback if the family is not found
+        */
+        [[nodiscard]] static sk_sp<SkTypeface> FromName(const std::string& family,
+                                                        SkFontStyle style = SkFontStyle::Normal());
+
+        /** Function for retrieving a typeface from a font file.
+
+            Note: Failed loads are not cached.
+
+            @param path     font file to load
+            @return         typeface, nullptr if the file could not be loaded
+        */
+        [[nodiscard]] static sk_sp<SkTypeface> FromFile(const std::string& path);
+
+        /** Function for loading families into the cache, before they are used.
+
+            @param families     family names to load
+        */
+        static void Preload(const std::vector<std::string>& families);
+
+        /** Function for setting the max memory used by the glyph cache.
+
+            @param bytes    max number of bytes
+        */
+        static void SetGlyphCacheLimit(std::size_t bytes);
+
+        /** Function for retrieving the usage of the cache.
+
+            @return     stats
+        */
+        [[nodiscard]] static Stats GetStats();
+
+        /** Function for removing all the cached typefaces.
+
+            Note: Typefaces in use are kept alive by their users.
+        */
+        static void Clear();
+    };
+} // namespace pTK
+
+#endif // PTK_CORE_TYPEFACECACHE_HPP
@@ -10,14 +10,18 @@
 
 // pTK Headers
 #include "Alignment.hpp"
+#include "ptk/core/DrawCache.hpp"
 #include "ptk/core/Drawable.hpp"
 #include "ptk/core/EventHandling.hpp"
 #include "ptk/core/Sizable.hpp"
 #include "ptk/core/WidgetInterface.hpp"
 #include "ptk/util/Point.hpp"
+#include "ptk/util/Rect.hpp"
 #include "ptk/util/SizePolicy.hpp"
 
 // C++ Headers
+#include <cstddef>
+#include <memory>
 #include <string>
 
 namespace pTK
@@ -89,6 +93,12 @@ namespace pTK
         */
         [[nodiscard]] const Point& getPosition() const;
 
+        /** Function for retrieving the current bounds of the Widget.
+
+            @return  current position and size
+        */
+        [[nodiscard]] Rect getBounds() const { return {m_pos, getSize()}; }
+
         /** Function for setting the name of the Widget.
 
             @param  name   name of the widget
@@ -111,6 +121,36 @@ namespace pTK
         */
         bool draw() override;
 
+        /** Function for drawing the Widget, replays the cache if possible.
+
+            Parents should draw their children with this function instead of onDraw.
+
+            @param canvas   valid Canvas pointer to draw to
+        */
+        void drawCached(Canvas* canvas);
+
+        /** Function for setting how the drawing of the Widget is cached.
+
+            Everything drawn in onDraw is cached, for a WidgetContainer that is
+            the whole subtree. The cache is invalidated when the Widget or any of
+            its children report damage.
+
+            @param policy   how to cache
+        */
+        void setCachePolicy(CachePolicy policy);
+
+        /** Function for retrieving how the drawing of the Widget is cached.
+
+            @return    policy
+        */
+        [[nodiscard]] CachePolicy getCachePolicy() const noexcept;
+
+        /** Function for retrieving the cache hit and miss counters.
+
+            @return    counters (zero if not cached)
+        */
+        [[nodiscard]] DrawCache::Stats getCacheStats() const noexcept;
+
         /** Function to enable drawing.
 
         */
@@ -171,6 +211,33 @@ namespace pTK
         */
         virtual bool drawChild(Widget*);
 
+        /** Function for reporting a damaged area that needs to be repainted.
+
+            Override this function for receiving damage from children,
+            default is to invalidate the draw cache and pass it on to the parent.
+
+            @param rect     damaged area (in window coordinates)
+        */
+        virtual void addDamage(const Rect& rect);
+
+        /** Function for reporting the bounds of the Widget as damaged.
+
+            Both the bounds from the last report and the current bounds
+            are reported, this covers both the old and new area when the
+            Widget has moved or changed size.
+        */
+        void reportDamage();
+
+        /** Function for notifying the parent of a draw request without
+            reporting the bounds of the Widget as damaged.
+
+            Used when forwarding draw requests from children, where only the
+            area of the child needs to be repainted.
+
+            @return    status
+        */
+        bool propagateDraw();
+
         /** Function for setting the position of the Widget without callback.
 
             @param pos  position of the Widget.
@@ -182,9 +249,16 @@ namespace pTK
         void onSizeChange(const Size& size) override;
         void onLimitChange(const Size& min, const Size& max) override;
 
+    private:
+        // Manages m_parentIndex.
+        friend class WidgetContainer;
+
     private:
         Widget* m_parent;
+        std::size_t m_parentIndex{0};
         Point m_pos;
+        Rect m_lastBounds{};
+        std::unique_ptr<DrawCache> m_cache{};
         std::string m_name;
         SizePolicy m_sizePolicy{};
     };
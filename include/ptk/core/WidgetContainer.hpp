@@ -9,11 +9,15 @@
 #define PTK_CORE_WIDGETCONTAINER_HPP
 
 // pTK Headers
+#include "ptk/core/SpatialIndex.hpp"
 #include "ptk/core/Widget.hpp"
+#include "ptk/util/SingleObject.hpp"
 
 // C++ Headers
+#include <iterator>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -39,6 +43,33 @@ namespace pTK
         using const_reverse_iterator = container_type::const_reverse_iterator;
         using size_type = std::size_t;
 
+        /** BatchUpdate class implementation.
+
+            Starts a batch update on construction and ends it on destruction.
+        */
+        class PTK_API BatchUpdate : public SingleObject
+        {
+        public:
+            /** Constructs BatchUpdate with container.
+
+                @param container    container to batch updates for
+                @return             initialized BatchUpdate
+            */
+            explicit BatchUpdate(WidgetContainer& container) noexcept
+                : m_container{container}
+            {
+                m_container.beginBatch();
+            }
+
+            /** Destructor for BatchUpdate.
+
+            */
+            ~BatchUpdate() override { m_container.endBatch(); }
+
+        private:
+            WidgetContainer& m_container;
+        };
+
     public:
         /** Constructs WidgetContainer with default values.
 
@@ -67,6 +98,7 @@ namespace pTK
 
             Does this in order:
                 - Will check if the widget already exists and add it if not.
+                - Removes the widget from its current container.
                 - Sets the parent of the widget to this container.
                 - calls onAdd
                 - queues for drawing
@@ -75,6 +107,26 @@ namespace pTK
         */
         void add(const value_type& widget);
 
+        /** Function for adding multiple Widgets to the WidgetContainer.
+
+            The Widgets are added in a batch update, meaning that the
+            layout is only updated and drawn once.
+
+            @param first    iterator to first widget
+            @param last     iterator to past-the-end widget
+        */
+        template <typename InputIt>
+        void addRange(InputIt first, InputIt last)
+        {
+            using category = typename std::iterator_traits<InputIt>::iterator_category;
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>)
+                m_holder.reserve(m_holder.size() + static_cast<size_type>(std::distance(first, last)));
+
+            BatchUpdate batch{*this};
+            for (; first != last; ++first)
+                add(*first);
+        }
+
         /** Function for removing a Widget from the WidgetContainer.
 
              Does this in order:
@@ -87,6 +139,29 @@ namespace pTK
         */
         void remove(const value_type& widget);
 
+        /** Function for starting a batch update.
+
+            While in a batch update, adding or removing Widgets and updates from
+            children will not update the layout or draw the container.
+            Instead, onBatchEnd is called and the container is drawn once when
+            the outermost batch update has ended.
+
+            Batch updates can be nested, every call to beginBatch must be
+            matched with a call to endBatch. Prefer BatchUpdate.
+        */
+        void beginBatch() noexcept;
+
+        /** Function for ending a batch update.
+
+        */
+        void endBatch();
+
+        /** Function for checking if a batch update is in progress.
+
+            @return     status
+        */
+        [[nodiscard]] bool batching() const noexcept { return m_batchDepth > 0; }
+
         /** Function for setting the position of the VBox and its children.
 
             @param pos     Position to set
@@ -125,6 +200,20 @@ namespace pTK
         */
         [[nodiscard]] const Color& getBackground() const;
 
+        /** Function for setting the structure used for finding children at a position.
+
+            Containers with few children will always be searched linearly.
+
+            @param type     structure to use
+        */
+        void setSpatialIndexType(SpatialIndex::Type type);
+
+        /** Function for retrieving the structure used for finding children at a position.
+
+            @return    structure in use
+        */
+        [[nodiscard]] SpatialIndex::Type spatialIndexType() const noexcept { return m_index.type(); }
+
         /** Function for retrieving the currently clicked on widget.
 
             @return    currently selected widget or nullptr
@@ -344,12 +433,15 @@ namespace pTK
 
         /** Function that paints all the children in the WidgetContainer.
 
+            Children outside of the current clip (damaged region) are skipped.
+
             @param canvas   valid Canvas pointer to draw to
         */
         void drawChildren(Canvas* canvas)
         {
             for (auto it = m_holder.begin(); it != m_holder.end(); ++it)
-                (*it)->onDraw(canvas);
+                if (!canvas->quickReject((*it)->getPosition(), (*it)->getSize()))
+                    (*it)->drawCached(canvas);
         }
 
     private:
@@ -370,6 +462,14 @@ namespace pTK
         */
         virtual void onRemove(const value_type& UNUSED(widget)) {}
 
+        /** Callback to use when a batch update has ended.
+
+            Only called if Widgets were added, removed or updated during the
+            batch update. onAdd, onRemove and onChildUpdate are not called for
+            changes made during a batch update.
+        */
+        virtual void onBatchEnd() {}
+
         /** Callback to use when the WidgetContainer is cleared.
 
             Note: This callback is called before the container is cleared.
@@ -378,6 +478,9 @@ namespace pTK
 
         /** Callback to use when a child has called the parent update function.
 
+            Note: Also called for children updated while handling an update
+                  (such as children resized by this callback).
+
             @param index   the index of the child
         */
         virtual void onChildUpdate(size_type UNUSED(index)) {}
@@ -395,6 +498,15 @@ namespace pTK
         */
         [[nodiscard]] virtual const_iterator findChildAtPos(const Point& pos) const;
 
+        /** Function for retrieving the child at a specific position using the spatial index.
+
+            The index is rebuilt if any child has changed since it was last built.
+
+            @param pos      position to search
+            @return         iterator to child or cend()
+        */
+        [[nodiscard]] const_iterator findIndexedChildAtPos(const Point& pos) const;
+
     private:
         /** Function for handling when a key is pressed or released.
 
@@ -450,35 +562,31 @@ namespace pTK
         void onReleaseCallback(const ReleaseEvent& evt);
 
     private:
-        /** ContainerEntryPair struct implementation.
+        /** Function for retrieving the entry of a child in the container.
 
-            Used to find and validate entries in the container.
+            Uses the index stored in the child, no search is performed.
             Helpful to get the shared_ptr to a widget from a raw pointer.
+
+            @param widget   child to find
+            @return         pointer to entry or nullptr if not a child
         */
-        struct PTK_API ContainerEntryPair
-        {
-            Widget* ptr{nullptr};
-            std::size_t index{0};
-        };
+        [[nodiscard]] const value_type* findEntry(const Widget* widget) const noexcept;
 
-        /** Function for checking if the ContainerEntryPair is a valid entry in the container.
+        /** Function for updating the index stored in the children, starting at first.
 
-            @param val      value to test
-            @return         status
+            @param first    index of first child to update
         */
-        [[nodiscard]] bool validEntryPair(ContainerEntryPair val) const noexcept
-        {
-            if (val.index < m_holder.size())
-                return (m_holder[val.index].get() == val.ptr);
-            return false;
-        }
+        void reindex(size_type first) noexcept;
 
     private:
         // Variables
         container_type m_holder{};
-        ContainerEntryPair m_lastClickedWidget{};
-        ContainerEntryPair m_currentHoverWidget{};
+        mutable SpatialIndex m_index{};
+        Widget* m_lastClickedWidget{nullptr};
+        Widget* m_currentHoverWidget{nullptr};
         Color m_background{0xf5f5f5ff};
+        size_type m_batchDepth{0};
+        bool m_batchChanged{false};
         bool m_busy{false};
     };
 
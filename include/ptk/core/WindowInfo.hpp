@@ -35,11 +35,13 @@ namespace pTK
         /** Backend enum class implementation
 
             Specifies which backend that should be used.
+            Headless renders to memory without a platform window (no display needed).
         */
         enum class Backend : uint8_t
         {
             Software = 1,
-            Hardware
+            Hardware,
+            Headless
 
             // TODO: Implement the following OpenGL and Metal to specify which backend.
             // They should also be a "subset" of the Hardware enum.
@@ -10,10 +10,13 @@
 
 // pTK Headers
 #include "ptk/core/Event.hpp"
-#include "ptk/core/Text.hpp"
 #include "ptk/events/KeyCodes.hpp"
+#include "ptk/util/UTF.hpp"
 
 // C++ Headers
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 
@@ -66,30 +69,12 @@ namespace pTK
               modifier{mod}
         {}
 
-        /** Constructs KeyEvent with default values with type and code.
-
-            @param type     press or release
-            @param code     associated keycode
-            @return         default initialized KeyEvent
-        */
-        constexpr KeyEvent(Event::Type t_type, KeyCode code, uint32_t ch, Text::Encoding enc,
-                           ModifierUnderlyingType mod = 0) noexcept
-            : Event(Event::Category::Keyboard, t_type),
-              keycode{code},
-              data{ch},
-              encoding{enc},
-              modifier{mod}
-        {}
-
         // Key code.
         KeyCode keycode{};
 
         // Contains the raw data (may be different depending on platform).
         uint32_t data{};
 
-        // Contains the encoding of the char.
-        Text::Encoding encoding{Text::Encoding::UTF8};
-
         // Modifiers.
         ModifierUnderlyingType modifier{};
 
@@ -103,36 +88,53 @@ namespace pTK
 
     /** InputEvent class implementation.
 
-        Signals keyboard or text input.
+        Signals keyboard or text input, as decoded code points (UTF-32).
+        The code points are stored in the event, no heap allocation is done.
     */
     class PTK_API InputEvent : public Event
     {
     public:
         using data_type = uint32_t;
-        using data_cont = std::unique_ptr<data_type[]>;
+
+        // Max number of code points in a single event.
+        static constexpr std::size_t capacity{32};
+
+        using data_cont = std::array<data_type, capacity>;
 
     public:
-        /** Constructs KeyEvent with default values with type and code.
+        /** Constructs InputEvent with code points.
 
-            @param type     press or release
-            @param code     associated keycode
-            @return         default initialized KeyEvent
+            Note: Only the first capacity code points are stored.
+
+            @param codepoints   array of code points
+            @param count        number of code points
+            @return             initialized InputEvent
+        */
+        InputEvent(const data_type* codepoints, std::size_t count) noexcept
+            : Event(Event::Category::Keyboard, Event::Type::KeyInput),
+              size{std::min(count, capacity)}
+        {
+            std::copy(codepoints, codepoints + size, data.begin());
+        }
+
+        /** Constructs InputEvent with UTF-8 text.
+
+            Note: Only the first capacity code points are decoded.
+
+            @param str      UTF-8 text
+            @param count    number of bytes in str
+            @return         initialized InputEvent
         */
-        InputEvent(data_cont& arr, std::size_t count, Text::Encoding enc = Text::Encoding::UTF8)
+        InputEvent(const char* str, std::size_t count) noexcept
             : Event(Event::Category::Keyboard, Event::Type::KeyInput),
-              data(std::move(arr)),
-              size{count},
-              encoding(enc)
+              size{UTF::DecodeUTF8(str, count, data.data(), capacity).written}
         {}
 
-        // Contains array of characters.
+        // Contains array of code points.
         data_cont data{};
 
-        // Number of characters.
+        // Number of code points.
         std::size_t size{};
-
-        // Contains the encoding of the array.
-        Text::Encoding encoding{Text::Encoding::UTF8};
     };
 
     constexpr bool IsKeyEventModifierSet(std::underlying_type<KeyEvent::Modifier>::type number,
@@ -9,9 +9,11 @@
 #define PTK_PLATFORM_APPLICATIONHANDLE_HPP
 
 // pTK Headers
+#include "ptk/core/EventSources.hpp"
 #include "ptk/util/SingleObject.hpp"
 
 // C++ Headers
+#include <cstdint>
 #include <memory>
 #include <string_view>
 
@@ -117,7 +119,55 @@ namespace pTK::Platform
         */
         virtual void onWindowRemove(int32_t UNUSED(key), Window* UNUSED(window)) {}
 
+        /** Function for setting if events should be coalesced.
+
+            When enabled, the platform drains its event queue before dispatching
+            and consecutive events of the same kind (motion, scroll and resize)
+            for the same window are collapsed into one. Enabled by default.
+
+            Note: Platforms that does not support this will ignore the setting.
+
+            @param value    coalesce events
+        */
+        void setEventCoalescing(bool value) noexcept { m_coalesceEvents = value; }
+
+        /** Function for retrieving if events are coalesced.
+
+            @return     status
+        */
+        [[nodiscard]] bool eventCoalescing() const noexcept { return m_coalesceEvents; }
+
+        /** Function for retrieving the number of events that have been coalesced.
+
+            Events that have been collapsed into another event are counted, the
+            event that is dispatched is not.
+
+            @return     number of coalesced events
+        */
+        [[nodiscard]] uint64_t coalescedEvents() const noexcept { return m_coalescedEvents; }
+
+        /** Function for retrieving the timers and file descriptor watchers.
+
+            @return     event sources
+        */
+        [[nodiscard]] EventSources& eventSources() noexcept { return m_sources; }
+
+        /** Function for checking if file descriptor watchers are waited on.
+
+            Platforms that support it wait on the watched file descriptors in
+            waitEvents and waitEventsTimeout together with the platform events.
+
+            @return     true if supported, otherwise false
+        */
+        [[nodiscard]] virtual bool supportsWatches() const noexcept { return false; }
+
     protected:
+        /** Function for adding to the number of coalesced events.
+
+            @param count    number of events coalesced
+        */
+        void addCoalescedEvents(uint64_t count) noexcept { m_coalescedEvents += count; }
+
         /** Function for retrieving the ApplicationBase.
 
             @return pointer to ApplicationBase
@@ -127,6 +177,9 @@ namespace pTK::Platform
     private:
         static std::unique_ptr<ApplicationHandle> s_handle;
         ApplicationBase* m_app{nullptr};
+        EventSources m_sources{};
+        uint64_t m_coalescedEvents{0};
+        bool m_coalesceEvents{true};
     };
 } // namespace pTK::Platform
 
@@ -47,7 +47,8 @@ namespace pTK
         public:
             /** Function for creating a context based on the info.
 
-                Creates a hardware context if the flag is defined.
+                Creates a headless context if the flag is defined, otherwise
+                a hardware context if the flag is defined.
                 If no hardware context is available on the platform, a raster
                 context will be created even if a hardware context is specified
                 in the flags.
@@ -63,6 +64,14 @@ namespace pTK
             */
             static std::unique_ptr<ContextBase> MakeRaster(Window* window, const Size& size, const Vec2f& scale);
 
+            /** Function for creating a raster context that is not tied to a window.
+
+                Renders to memory only, available on all platforms.
+
+                @return     Raster Context
+            */
+            static std::unique_ptr<ContextBase> MakeHeadless(const Size& size, const Vec2f& scale);
+
             /** Function for creating a OpenGL context for hardware rendering.
 
                 Note: will return nullptr if backend is not available.
@@ -25,7 +25,7 @@ namespace pTK::Platform
         All drawings will be done using the CPU.
 
         Be sure to override:
-            - void swapBuffers();
+            - void swapBuffers(const DamageRegion&);
             - void* onResize(const Size&);
 
         And, the constructor must call resize().
@@ -56,6 +56,14 @@ namespace pTK::Platform
         */
         [[nodiscard]] sk_sp<SkSurface> surface() const override { return m_surface; }
 
+        /** Function for checking if the content of the surface is kept after swapBuffers.
+
+            The pixel storage is owned by the context and is only replaced on resize.
+
+            @return    status
+        */
+        [[nodiscard]] bool preservesContent() const noexcept override { return true; }
+
     private:
         // Called on resize, return the pointer to pixel storage, on failure return nullptr.
         virtual void* onResize(const Size& UNUSED(size)) = 0;
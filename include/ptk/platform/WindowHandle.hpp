@@ -196,6 +196,14 @@ namespace pTK::Platform
         */
         [[nodiscard]] virtual std::size_t targetRefreshRate() const noexcept { return 60; }
 
+        /** Function for retrieving the refresh rate of the monitor the window is on.
+
+            Fractional rates (such as 59.94 Hz) are kept.
+
+            @return     refresh rate in Hz
+        */
+        [[nodiscard]] virtual double refreshRate() const noexcept { return static_cast<double>(targetRefreshRate()); }
+
         /** Function for retrieving the window.
 
             @return pointer to WindowBase
@@ -17,16 +17,26 @@
 #include "ptk/core/ApplicationBase.hpp"
 #include "ptk/core/CallbackStorage.hpp"
 #include "ptk/core/CommandBuffer.hpp"
+#include "ptk/core/CommandQueue.hpp"
 #include "ptk/core/ContextBase.hpp"
+#include "ptk/core/DamageRegion.hpp"
 #include "ptk/core/Defines.hpp"
+#include "ptk/core/DrawCache.hpp"
 #include "ptk/core/Drawable.hpp"
 #include "ptk/core/Event.hpp"
 #include "ptk/core/EventCallbacks.hpp"
 #include "ptk/core/EventFunctions.hpp"
 #include "ptk/core/EventHandling.hpp"
+#include "ptk/core/EventSources.hpp"
 #include "ptk/core/Exception.hpp"
+#include "ptk/core/FrameScheduler.hpp"
+#include "ptk/core/Profiler.hpp"
+#include "ptk/core/ShapedText.hpp"
 #include "ptk/core/Sizable.hpp"
+#include "ptk/core/SpatialIndex.hpp"
 #include "ptk/core/Text.hpp"
+#include "ptk/core/TextLayout.hpp"
+#include "ptk/core/TypefaceCache.hpp"
 #include "ptk/core/Widget.hpp"
 #include "ptk/core/WidgetContainer.hpp"
 #include "ptk/core/WidgetInterface.hpp"
@@ -53,15 +63,18 @@
 
 // --- Util --------------------------
 #include "ptk/util/Color.hpp"
+#include "ptk/util/InplaceFunction.hpp"
 #include "ptk/util/Math.hpp"
 #include "ptk/util/NonCopyable.hpp"
 #include "ptk/util/NonMovable.hpp"
 #include "ptk/util/Point.hpp"
+#include "ptk/util/Rect.hpp"
 #include "ptk/util/SafeQueue.hpp"
 #include "ptk/util/Semaphore.hpp"
 #include "ptk/util/SingleObject.hpp"
 #include "ptk/util/Size.hpp"
 #include "ptk/util/SizePolicy.hpp"
+#include "ptk/util/UTF.hpp"
 #include "ptk/util/Vec2.hpp"
 
 // --- Widgets -----------------------
@@ -71,6 +84,8 @@
 #include "ptk/widgets/HBox.hpp"
 #include "ptk/widgets/Image.hpp"
 #include "ptk/widgets/Label.hpp"
+#include "ptk/widgets/ListView.hpp"
+#include "ptk/widgets/TextArea.hpp"
 #include "ptk/widgets/TextField.hpp"
 #include "ptk/widgets/VBox.hpp"
 
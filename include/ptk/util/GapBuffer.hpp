@@ -0,0 +1,200 @@
+//
+//  util/GapBuffer.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_UTIL_GAPBUFFER_HPP
+#define PTK_UTIL_GAPBUFFER_HPP
+
+// C++ Headers
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace pTK
+{
+    /** GapBuffer class implementation.
+
+        Sequence with an unused gap at the last edit position. Inserting or
+        erasing at the gap is O(1) amortized, the gap is moved (O(distance))
+        when editing elsewhere. Suited for text editing where most edits
+        happen at (or close to) the cursor.
+
+        T must be default constructible and copyable.
+    */
+    template <typename T>
+    class GapBuffer
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+    public:
+        /** Constructs GapBuffer with default values.
+
+            @return  default initialized GapBuffer
+        */
+        GapBuffer() = default;
+
+        /** Function for retrieving the number of elements.
+
+            @return  number of elements
+        */
+        [[nodiscard]] size_type size() const noexcept { return m_data.size() - gapSize(); }
+
+        /** Function for checking if the buffer is empty.
+
+            @return  true if empty, otherwise false
+        */
+        [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+        /** Operator for retrieving an element.
+
+            @param pos  index of the element (< size())
+            @return     element at pos
+        */
+        [[nodiscard]] const T& operator[](size_type pos) const noexcept
+        {
+            return m_data[(pos < m_gapStart) ? pos : (pos + gapSize())];
+        }
+
+        /** Function for replacing the content.
+
+            @param data     elements to copy
+            @param count    number of elements
+        */
+        void assign(const T* data, size_type count)
+        {
+            m_data.assign(data, data + count);
+            m_gapStart = count;
+            m_gapEnd = count;
+        }
+
+        /** Function for removing all elements.
+
+        */
+        void clear() noexcept
+        {
+            m_gapStart = 0;
+            m_gapEnd = m_data.size();
+        }
+
+        /** Function for inserting elements.
+
+            @param pos      index to insert at (<= size())
+            @param data     elements to copy
+            @param count    number of elements
+        */
+        void insert(size_type pos, const T* data, size_type count)
+        {
+            if (count > 0)
+                std::copy(data, data + count, insert(pos, count));
+        }
+
+        /** Function for inserting elements to be written by the caller.
+
+            The inserted elements are contiguous and have unspecified values.
+
+            @param pos      index to insert at (<= size())
+            @param count    number of elements
+            @return         first inserted element
+        */
+        T* insert(size_type pos, size_type count)
+        {
+            if (gapSize() < count)
+                grow(count);
+
+            moveGap(pos);
+            T* data{m_data.data() + m_gapStart};
+            m_gapStart += count;
+            return data;
+        }
+
+        /** Function for erasing elements.
+
+            @param pos      index of the first element to erase
+            @param count    number of elements (pos + count <= size())
+        */
+        void erase(size_type pos, size_type count)
+        {
+            moveGap(pos);
+            m_gapEnd += count;
+        }
+
+        /** Function for visiting a range as contiguous spans (at most two).
+
+            @param pos      index of the first element
+            @param count    number of elements (pos + count <= size())
+            @param func     called with (const T* data, size_type count) for each span
+        */
+        template <typename Func>
+        void forEachSpan(size_type pos, size_type count, Func&& func) const
+        {
+            const size_type end{pos + count};
+            if (pos < m_gapStart)
+            {
+                const size_type first{std::min(end, m_gapStart)};
+                func(m_data.data() + pos, first - pos);
+                pos = first;
+            }
+
+            if (pos < end)
+                func(m_data.data() + pos + gapSize(), end - pos);
+        }
+
+    private:
+        [[nodiscard]] size_type gapSize() const noexcept { return m_gapEnd - m_gapStart; }
+
+        void moveGap(size_type pos)
+        {
+            const auto data = m_data.begin();
+            if (pos < m_gapStart)
+            {
+                // Elements between pos and the gap are moved to the end of the gap.
+                std::copy_backward(data + static_cast<std::ptrdiff_t>(pos),
+                                   data + static_cast<std::ptrdiff_t>(m_gapStart),
+                                   data + static_cast<std::ptrdiff_t>(m_gapEnd));
+                m_gapEnd -= m_gapStart - pos;
+                m_gapStart = pos;
+            }
+            else if (pos > m_gapStart)
+            {
+                // Elements between the gap and pos are moved to the start of the gap.
+                const size_type count{pos - m_gapStart};
+                std::copy(data + static_cast<std::ptrdiff_t>(m_gapEnd),
+                          data + static_cast<std::ptrdiff_t>(m_gapEnd + count),
+                          data + static_cast<std::ptrdiff_t>(m_gapStart));
+                m_gapStart += count;
+                m_gapEnd += count;
+            }
+        }
+
+        void grow(size_type count)
+        {
+            // Doubles the capacity to keep inserts amortized O(1).
+            const size_type required{size() + count};
+            const size_type capacity{std::max({required, m_data.size() * 2, s_minCapacity})};
+            const size_type tail{m_data.size() - m_gapEnd};
+
+            std::vector<T> data(capacity);
+            const auto src = m_data.begin();
+            std::copy(src, src + static_cast<std::ptrdiff_t>(m_gapStart), data.begin());
+            std::copy(src + static_cast<std::ptrdiff_t>(m_gapEnd), m_data.end(),
+                      data.end() - static_cast<std::ptrdiff_t>(tail));
+
+            m_data.swap(data);
+            m_gapEnd = capacity - tail;
+        }
+
+    private:
+        static constexpr size_type s_minCapacity{64};
+
+        std::vector<T> m_data{};
+        size_type m_gapStart{0};
+        size_type m_gapEnd{0};
+    };
+} // namespace pTK
+
+#endif // PTK_UTIL_GAPBUFFER_HPP
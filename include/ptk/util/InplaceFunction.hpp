@@ -0,0 +1,222 @@
+//
+//  util/InplaceFunction.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_UTIL_INPLACEFUNCTION_HPP
+#define PTK_UTIL_INPLACEFUNCTION_HPP
+
+// C++ Headers
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace pTK
+{
+    // Default size of the inline buffer in InplaceFunction.
+    inline constexpr std::size_t InplaceFunctionCapacity{48};
+
+    template <typename Signature, std::size_t Capacity = InplaceFunctionCapacity>
+    class InplaceFunction;
+
+    /** InplaceFunction class implementation.
+
+        Function wrapper similar to std::function, but the callable is always
+        stored in an inline buffer of Capacity bytes and never on the heap.
+        Calling it is a single indirect call.
+
+        Callables that do not fit in the buffer are rejected at compile time,
+        they must be copy constructible and should not throw when moved.
+    */
+    template <typename R, typename... Args, std::size_t Capacity>
+    class InplaceFunction<R(Args...), Capacity>
+    {
+    private:
+        using storage_type = std::aligned_storage_t<Capacity, alignof(std::max_align_t)>;
+
+        // Operations for the stored callable, one static instance per callable type.
+        struct VTable
+        {
+            R (*invoke)(void*, Args&&...);
+            void (*copy)(void*, const void*);
+            void (*move)(void*, void*) noexcept;
+            void (*destroy)(void*) noexcept;
+        };
+
+        template <typename F>
+        static constexpr VTable s_vtable{
+            [](void* self, Args&&... args) -> R {
+                if constexpr (std::is_void_v<R>)
+                    std::invoke(*static_cast<F*>(self), std::forward<Args>(args)...);
+                else
+                    return std::invoke(*static_cast<F*>(self), std::forward<Args>(args)...);
+            },
+            [](void* dst, const void* src) { ::new (dst) F(*static_cast<const F*>(src)); },
+            [](void* dst, void* src) noexcept {
+                ::new (dst) F(std::move(*static_cast<F*>(src)));
+                static_cast<F*>(src)->~F();
+            },
+            [](void* self) noexcept { static_cast<F*>(self)->~F(); }};
+
+        template <typename F>
+        static constexpr bool IsCallable = !std::is_same_v<std::decay_t<F>, InplaceFunction> &&
+                                           std::is_invocable_r_v<R, std::decay_t<F>&, Args...>;
+
+    public:
+        /** Constructs InplaceFunction with default values.
+
+            @return    empty InplaceFunction
+        */
+        InplaceFunction() noexcept = default;
+
+        /** Constructs InplaceFunction with nullptr.
+
+            @return    empty InplaceFunction
+        */
+        InplaceFunction(std::nullptr_t) noexcept {}
+
+        /** Constructs InplaceFunction with callable.
+
+            @param func     callable to store
+            @return         InplaceFunction storing func
+        */
+        template <typename F, typename = std::enable_if_t<IsCallable<F>>>
+        InplaceFunction(F&& func)
+        {
+            using type = std::decay_t<F>;
+            static_assert(sizeof(type) <= Capacity, "Callable does not fit in InplaceFunction");
+            static_assert(alignof(std::max_align_t) % alignof(type) == 0, "Callable alignment is not supported");
+            static_assert(std::is_copy_constructible_v<type>, "Callable must be copy constructible");
+
+            ::new (static_cast<void*>(&m_storage)) type(std::forward<F>(func));
+            m_vtable = &s_vtable<type>;
+        }
+
+        /** Copy Constructor for InplaceFunction.
+
+            @return    copy of other
+        */
+        InplaceFunction(const InplaceFunction& other)
+        {
+            if (other.m_vtable != nullptr)
+            {
+                other.m_vtable->copy(&m_storage, &other.m_storage);
+                m_vtable = other.m_vtable;
+            }
+        }
+
+        /** Move Constructor for InplaceFunction.
+
+            @return    initialized InplaceFunction from value
+        */
+        InplaceFunction(InplaceFunction&& other) noexcept
+        {
+            if (other.m_vtable != nullptr)
+            {
+                other.m_vtable->move(&m_storage, &other.m_storage);
+                m_vtable = std::exchange(other.m_vtable, nullptr);
+            }
+        }
+
+        /** Destructor for InplaceFunction.
+
+        */
+        ~InplaceFunction() { reset(); }
+
+        /** Copy Assignment operator for InplaceFunction.
+
+            @return    InplaceFunction with value
+        */
+        InplaceFunction& operator=(const InplaceFunction& other)
+        {
+            if (this != &other)
+            {
+                InplaceFunction copy{other};
+                *this = std::move(copy);
+            }
+            return *this;
+        }
+
+        /** Move Assignment operator for InplaceFunction.
+
+            @return    InplaceFunction with value
+        */
+        InplaceFunction& operator=(InplaceFunction&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                if (other.m_vtable != nullptr)
+                {
+                    other.m_vtable->move(&m_storage, &other.m_storage);
+                    m_vtable = std::exchange(other.m_vtable, nullptr);
+                }
+            }
+            return *this;
+        }
+
+        /** Assignment operator for InplaceFunction with callable.
+
+            The callable is constructed directly in the buffer.
+
+            @param func     callable to store
+            @return         InplaceFunction storing func
+        */
+        template <typename F, typename = std::enable_if_t<IsCallable<F>>>
+        InplaceFunction& operator=(F&& func)
+        {
+            using type = std::decay_t<F>;
+            static_assert(sizeof(type) <= Capacity, "Callable does not fit in InplaceFunction");
+            static_assert(alignof(std::max_align_t) % alignof(type) == 0, "Callable alignment is not supported");
+            static_assert(std::is_copy_constructible_v<type>, "Callable must be copy constructible");
+
+            reset();
+            ::new (static_cast<void*>(&m_storage)) type(std::forward<F>(func));
+            m_vtable = &s_vtable<type>;
+            return *this;
+        }
+
+        /** Function for calling the stored callable.
+
+            Throws std::bad_function_call if no callable is stored.
+
+            @param args     arguments to pass
+            @return         result of the callable
+        */
+        R operator()(Args... args) const
+        {
+            if (m_vtable == nullptr)
+                throw std::bad_function_call{};
+
+            return m_vtable->invoke(const_cast<storage_type*>(&m_storage), std::forward<Args>(args)...);
+        }
+
+        /** Function for checking if a callable is stored.
+
+            @return     true if a callable is stored, otherwise false
+        */
+        explicit operator bool() const noexcept { return m_vtable != nullptr; }
+
+        /** Function for removing the stored callable.
+
+        */
+        void reset() noexcept
+        {
+            if (m_vtable != nullptr)
+            {
+                m_vtable->destroy(&m_storage);
+                m_vtable = nullptr;
+            }
+        }
+
+    private:
+        storage_type m_storage;
+        const VTable* m_vtable{nullptr};
+    };
+} // namespace pTK
+
+#endif // PTK_UTIL_INPLACEFUNCTION_HPP
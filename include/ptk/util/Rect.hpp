@@ -0,0 +1,110 @@
+//
+//  util/Rect.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_UTIL_RECT_HPP
+#define PTK_UTIL_RECT_HPP
+
+// pTK Headers
+#include "ptk/core/Defines.hpp"
+#include "ptk/util/Point.hpp"
+#include "ptk/util/Size.hpp"
+
+namespace pTK
+{
+    /** Rect class implementation.
+
+        This class is low level class handling a rectangle (position and size).
+        The rectangle is half-open, meaning that pos is inside the rectangle and
+        pos + size is outside of it.
+    */
+    class PTK_API Rect
+    {
+    public:
+        /** Constructs Rect with default values.
+
+            @return    default initialized Rect
+        */
+        constexpr Rect() noexcept = default;
+
+        /** Constructs Rect with default values with t_pos and t_size.
+
+            @param t_pos    position of the rectangle
+            @param t_size   size of the rectangle
+            @return         default initialized Rect
+        */
+        constexpr Rect(const Point& t_pos, const Size& t_size) noexcept
+            : pos{t_pos},
+              size{t_size}
+        {}
+
+        /** Function for retrieving the right edge of the rectangle.
+
+            @return    x position + width
+        */
+        [[nodiscard]] Point::value_type right() const noexcept;
+
+        /** Function for retrieving the bottom edge of the rectangle.
+
+            @return    y position + height
+        */
+        [[nodiscard]] Point::value_type bottom() const noexcept;
+
+        /** Function for checking if the rectangle is empty.
+
+            @return    true if width or height is zero, otherwise false
+        */
+        [[nodiscard]] bool isEmpty() const noexcept { return (size.width == 0) || (size.height == 0); }
+
+        /** Function for checking if a point is inside the rectangle.
+
+            @param point    point to check
+            @return         true if inside, otherwise false
+        */
+        [[nodiscard]] bool contains(const Point& point) const noexcept;
+
+        /** Function for checking if another rectangle is completely inside the rectangle.
+
+            @param other    rectangle to check
+            @return         true if inside, otherwise false
+        */
+        [[nodiscard]] bool contains(const Rect& other) const noexcept;
+
+        /** Function for checking if another rectangle overlaps the rectangle.
+
+            Empty rectangles never intersects anything.
+
+            @param other    rectangle to check
+            @return         true if overlapping, otherwise false
+        */
+        [[nodiscard]] bool intersects(const Rect& other) const noexcept;
+
+        /** Function for retrieving the overlapping area of two rectangles.
+
+            @param other    rectangle to intersect with
+            @return         overlapping area or an empty Rect
+        */
+        [[nodiscard]] Rect intersected(const Rect& other) const noexcept;
+
+        /** Function for retrieving the smallest rectangle containing both rectangles.
+
+            Empty rectangles are ignored.
+
+            @param other    rectangle to unite with
+            @return         bounding rectangle
+        */
+        [[nodiscard]] Rect united(const Rect& other) const noexcept;
+
+        Point pos{};
+        Size size{};
+    };
+
+    // Comparison operators.
+    PTK_API bool operator==(const Rect& lhs, const Rect& rhs);
+    PTK_API bool operator!=(const Rect& lhs, const Rect& rhs);
+} // namespace pTK
+
+#endif // PTK_UTIL_RECT_HPP
@@ -0,0 +1,183 @@
+//
+//  util/UTF.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_UTIL_UTF_HPP
+#define PTK_UTIL_UTF_HPP
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+
+//
+// Conversion between UTF-8, UTF-16 and code points (UTF-32).
+//
+// Decoding is validating, each invalid sequence (overlong, surrogate, out of range
+// or truncated) is decoded as one U+FFFD.
+//
+
+namespace pTK::UTF
+{
+    // Code point for invalid sequences.
+    constexpr uint32_t ReplacementChar{0xFFFD};
+
+    // Number of code units read and code points written by a decode.
+    struct DecodeResult
+    {
+        std::size_t read;
+        std::size_t written;
+    };
+
+    /** Function for checking if a byte starts a UTF-8 char.
+
+        @param c    byte
+        @return     true if c is not a continuation byte (10xxxxxx)
+    */
+    constexpr bool IsCharStart(char c) noexcept
+    {
+        return (static_cast<unsigned char>(c) & 0xC0) != 0x80;
+    }
+
+    /** Function for decoding UTF-8 to code points.
+
+        Stops when the text is decoded or when capacity code points are written.
+
+        @param str          UTF-8 text
+        @param size         number of bytes in str
+        @param out          buffer for the code points
+        @param capacity     max number of code points in out
+        @return             bytes read and code points written
+    */
+    inline DecodeResult DecodeUTF8(const char* str, std::size_t size, uint32_t* out, std::size_t capacity) noexcept
+    {
+        std::size_t i{0};
+        std::size_t n{0};
+        while ((i < size) && (n < capacity))
+        {
+            const auto lead{static_cast<unsigned char>(str[i])};
+            if (lead < 0x80)
+            {
+                out[n++] = lead;
+                ++i;
+                continue;
+            }
+
+            // Length of the sequence and the valid range of the second byte, the range
+            // excludes overlong forms, surrogates and code points above U+10FFFF.
+            std::size_t length{0};
+            uint32_t cp{0};
+            unsigned char low{0x80};
+            unsigned char high{0xBF};
+            if ((lead >= 0xC2) && (lead <= 0xDF))
+            {
+                length = 2;
+                cp = lead & 0x1Fu;
+            }
+            else if ((lead >= 0xE0) && (lead <= 0xEF))
+            {
+                length = 3;
+                cp = lead & 0x0Fu;
+                low = (lead == 0xE0) ? 0xA0 : low;
+                high = (lead == 0xED) ? 0x9F : high;
+            }
+            else if ((lead >= 0xF0) && (lead <= 0xF4))
+            {
+                length = 4;
+                cp = lead & 0x07u;
+                low = (lead == 0xF0) ? 0x90 : low;
+                high = (lead == 0xF4) ? 0x8F : high;
+            }
+
+            // The valid part of an invalid sequence is replaced as a whole.
+            std::size_t j{1};
+            for (; (j < length) && ((i + j) < size); ++j)
+            {
+                const auto c{static_cast<unsigned char>(str[i + j])};
+                if ((c < low) || (c > high))
+                    break;
+
+                cp = (cp << 6) | (c & 0x3Fu);
+                low = 0x80;
+                high = 0xBF;
+            }
+
+            out[n++] = ((length != 0) && (j == length)) ? cp : ReplacementChar;
+            i += j;
+        }
+
+        return {i, n};
+    }
+
+    /** Function for decoding UTF-16 to code points.
+
+        Stops when the text is decoded or when capacity code points are written.
+
+        @param str          UTF-16 text
+        @param size         number of code units in str
+        @param out          buffer for the code points
+        @param capacity     max number of code points in out
+        @return             code units read and code points written
+    */
+    inline DecodeResult DecodeUTF16(const char16_t* str, std::size_t size, uint32_t* out,
+                                    std::size_t capacity) noexcept
+    {
+        std::size_t i{0};
+        std::size_t n{0};
+        while ((i < size) && (n < capacity))
+        {
+            const uint32_t unit{str[i++]};
+            if ((unit < 0xD800) || (unit > 0xDFFF))
+                out[n++] = unit;
+            else if ((unit <= 0xDBFF) && (i < size) && (str[i] >= 0xDC00) && (str[i] <= 0xDFFF))
+                out[n++] = 0x10000 + ((unit - 0xD800) << 10) + (static_cast<uint32_t>(str[i++]) - 0xDC00);
+            else
+                out[n++] = ReplacementChar;
+        }
+
+        return {i, n};
+    }
+
+    /** Function for encoding a code point as UTF-8.
+
+        Invalid code points are encoded as U+FFFD.
+
+        @param cp       code point
+        @param out      buffer with room for at least 4 bytes
+        @return         number of bytes written
+    */
+    inline std::size_t EncodeUTF8(uint32_t cp, char* out) noexcept
+    {
+        if (((cp >= 0xD800) && (cp <= 0xDFFF)) || (cp > 0x10FFFF))
+            cp = ReplacementChar;
+
+        if (cp < 0x80)
+        {
+            out[0] = static_cast<char>(cp);
+            return 1;
+        }
+        if (cp < 0x800)
+        {
+            out[0] = static_cast<char>(0xC0 | (cp >> 6));
+            out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+            return 2;
+        }
+        if (cp < 0x10000)
+        {
+            out[0] = static_cast<char>(0xE0 | (cp >> 12));
+            out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+            return 3;
+        }
+
+        out[0] = static_cast<char>(0xF0 | (cp >> 18));
+        out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+        return 4;
+    }
+} // namespace pTK::UTF
+
+#endif // PTK_UTIL_UTF_HPP
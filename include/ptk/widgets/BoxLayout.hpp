@@ -11,6 +11,9 @@
 // pTK Headers
 #include "ptk/core/WidgetContainer.hpp"
 
+// C++ Headers
+#include <vector>
+
 namespace pTK
 {
     /** BoxLayout class implementation.
@@ -121,6 +124,13 @@ namespace pTK
         */
         virtual void expandOnAdd(Size size, Point pos);
 
+        /** Function for updating the minimal size and fitting the children
+            inside the BoxLayout.
+
+            Called when children have been added.
+        */
+        virtual void fitChildren();
+
         /** Function for checking if the direction is allowed.
 
             @param direction    new direction
@@ -149,6 +159,21 @@ namespace pTK
         */
         void drawChildrenWithDir(Canvas* canvas);
 
+        /** Function for marking the cached limits of a child as outdated.
+
+            Should be called when the limits, size policy or margin of the child
+            has changed. Changes made while the children are being refitted are
+            applied by refitting again.
+
+            @param index    index of the child
+        */
+        void invalidateChildLimits(size_type index);
+
+        /** Function for marking the cached limits of all children as outdated.
+
+        */
+        void invalidateChildLimits() noexcept;
+
         /** Function for setting the ordering direction of the BoxLayout.
 
             In contrast to setDirection, this function will not call the callbacks
@@ -161,11 +186,35 @@ namespace pTK
     private:
         void onAdd(const value_type&) override;
         void onRemove(const value_type&) override;
+        void onBatchEnd() override;
         void onChildUpdate(size_type) override;
         void onSizeChange(const Size& size) override;
 
+        /** Function for updating the cached limits of the children.
+
+            Only children that have been added, replaced or marked as outdated
+            are queried again.
+
+            @return     true if any limits changed
+        */
+        bool updateLimitsCache() const;
+
     private:
+        // Max number of times the content is refitted when children change their limits.
+        static constexpr std::size_t s_maxRefitPasses{4};
+
         Direction m_direction{Direction::LeftToRight};
+
+        // Cached outer limits (margin and size policy included) for each child,
+        // m_cachedChildren holds the child the entry was computed from.
+        mutable std::vector<const Widget*> m_cachedChildren{};
+        mutable std::vector<Size> m_minSizes{};
+        mutable std::vector<Size> m_maxSizes{};
+        mutable std::vector<size_type> m_outdatedChildren{};
+        mutable Size m_contentMin{};
+        mutable Size m_contentMax{};
+        mutable bool m_contentValid{false};
+        bool m_refitting{false};
     };
 
     constexpr bool IsHorizontalOrdering(BoxLayout::Direction direction) noexcept
@@ -0,0 +1,202 @@
+//
+//  widgets/ListView.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_WIDGETS_LISTVIEW_HPP
+#define PTK_WIDGETS_LISTVIEW_HPP
+
+// pTK Headers
+#include "ptk/core/WidgetContainer.hpp"
+#include "ptk/events/MouseEvent.hpp"
+
+// C++ Headers
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace pTK
+{
+    /** ListView class implementation.
+
+        Scrollable list of rows that only creates widgets for the visible rows.
+        Rows are provided by a DataSource, the widgets are kept in a small pool
+        and rebound to new rows when the list is scrolled.
+
+        All rows have the same height, which keeps mapping between scroll offset
+        and row constant time and the memory usage independent of the row count.
+    */
+    class PTK_API ListView : public WidgetContainer
+    {
+    public:
+        /** DataSource struct implementation.
+
+            Provides the rows for the ListView.
+                - count: number of rows.
+                - create: creates a widget that can display any row.
+                - bind: updates a widget to display the row at index.
+        */
+        struct PTK_API DataSource
+        {
+            std::function<size_type()> count{};
+            std::function<value_type()> create{};
+            std::function<void(Widget& widget, size_type index)> bind{};
+        };
+
+        // Returned when no row is bound.
+        static constexpr size_type npos{std::numeric_limits<size_type>::max()};
+
+    public:
+        /** Constructs ListView with default values.
+
+            @return    default initialized ListView
+        */
+        ListView();
+
+        /** Destructor for ListView.
+
+        */
+        ~ListView() override = default;
+
+        /** Deleted Copy Constructor.
+
+            Copying is prohibited (for now).
+        */
+        ListView(const ListView&) = delete;
+
+        /** Deleted Copy Assignment operator.
+
+            Copying is prohibited (for now).
+        */
+        ListView& operator=(const ListView&) = delete;
+
+        /** Function for setting the source of the rows.
+
+            Rows are reloaded from the new source.
+
+            @param source   row provider
+        */
+        void setDataSource(DataSource source);
+
+        /** Function for reloading the rows from the source.
+
+            Should be called when the row count or the row content has changed.
+        */
+        void reloadData();
+
+        /** Function for retrieving the number of rows.
+
+            @return    row count
+        */
+        [[nodiscard]] size_type rowCount() const noexcept { return m_rowCount; }
+
+        /** Function for setting the height of the rows.
+
+            @param height   height of a row
+        */
+        void setRowHeight(Size::value_type height);
+
+        /** Function for retrieving the height of the rows.
+
+            @return    height of a row
+        */
+        [[nodiscard]] Size::value_type getRowHeight() const noexcept { return m_rowHeight; }
+
+        /** Function for setting the scroll offset.
+
+            Offset is clamped to the scrollable range.
+
+            @param offset   distance from the top of the first row
+        */
+        void setScrollOffset(uint64_t offset);
+
+        /** Function for retrieving the scroll offset.
+
+            @return    distance from the top of the first row
+        */
+        [[nodiscard]] uint64_t getScrollOffset() const noexcept { return m_scrollOffset; }
+
+        /** Function for setting the distance scrolled for each step of a ScrollEvent.
+
+            @param step     distance in pixels
+        */
+        void setScrollStep(float step) noexcept { m_scrollStep = step; }
+
+        /** Function for retrieving the distance scrolled for each step of a ScrollEvent.
+
+            @return    distance in pixels
+        */
+        [[nodiscard]] float getScrollStep() const noexcept { return m_scrollStep; }
+
+        /** Function for scrolling a row into view.
+
+            @param index    row to show
+        */
+        void scrollToRow(size_type index);
+
+        /** Function for retrieving the first visible row.
+
+            @return    index of the first visible row or npos
+        */
+        [[nodiscard]] size_type firstVisibleRow() const noexcept;
+
+        /** Function for retrieving the number of (partially) visible rows.
+
+            @return    visible row count
+        */
+        [[nodiscard]] size_type visibleRowCount() const noexcept;
+
+        /** Function for retrieving the row a widget is currently bound to.
+
+            @param widget   row widget
+            @return         row index or npos
+        */
+        [[nodiscard]] size_type rowOf(const Widget* widget) const noexcept;
+
+        /** Draw function.
+
+            Function is called when it is time to draw.
+
+            @param canvas   valid Canvas pointer to draw to
+        */
+        void onDraw(Canvas* canvas) override;
+
+    private:
+        void onSizeChange(const Size& size) override;
+        [[nodiscard]] const_iterator findChildAtPos(const Point& pos) const override;
+
+        /** Function for handling when mouse is scrolling.
+
+            @param evt      scroll event
+        */
+        void onScroll(const ScrollEvent& evt);
+
+        /** Function for resizing the pool and positioning the visible rows.
+
+            Widgets are only rebound when they are assigned a new row.
+        */
+        void layoutRows();
+
+        /** Function for retrieving the largest valid scroll offset.
+
+            @return    max offset
+        */
+        [[nodiscard]] uint64_t maxScrollOffset() const noexcept;
+
+    private:
+        DataSource m_source{};
+
+        // Row bound to each widget in the pool, row r is displayed by widget r % pool size.
+        std::vector<size_type> m_boundRows{};
+
+        size_type m_rowCount{0};
+        uint64_t m_scrollOffset{0};
+        float m_scrollStep{48.0f};
+        Size::value_type m_rowHeight{24};
+    };
+} // namespace pTK
+
+#endif // PTK_WIDGETS_LISTVIEW_HPP
@@ -0,0 +1,133 @@
+//
+//  widgets/TextArea.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_WIDGETS_TEXTAREA_HPP
+#define PTK_WIDGETS_TEXTAREA_HPP
+
+// pTK Headers
+#include "ptk/core/ShapedText.hpp"
+#include "ptk/core/Text.hpp"
+#include "ptk/core/TextLayout.hpp"
+#include "ptk/core/Widget.hpp"
+#include "ptk/util/Color.hpp"
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+namespace pTK
+{
+    /** TextArea class implementation.
+
+        This class is for drawing multiple lines of (read-only) text, such as
+        logs. Lines are wrapped to the width of the TextArea and only the
+        visible lines are shaped and drawn.
+    */
+    class PTK_API TextArea : public Widget, public Text
+    {
+    public:
+        /** Constructs TextArea with default values.
+
+            @return    default initialized TextArea
+        */
+        TextArea();
+
+        /** Move Constructor for TextArea.
+
+            @return    initialized TextArea from value
+        */
+        TextArea(TextArea&& other) = default;
+
+        /** Move Assignment operator for TextArea.
+
+            @return    TextArea with value
+        */
+        TextArea& operator=(TextArea&& other) = default;
+
+        /** Destructor for TextArea.
+
+        */
+        virtual ~TextArea() = default;
+
+        /** Function is called when it is time to draw.
+
+            @param canvas   valid Canvas pointer to draw to
+        */
+        void onDraw(Canvas* canvas) override;
+
+        /** Function for setting the text.
+
+            Note: Will apply the height of the lines as min height.
+
+            @param str      new text (lines separated by '\n')
+        */
+        void setText(const std::string& str);
+
+        /** Function for retrieving current set text.
+
+            @return    text
+        */
+        [[nodiscard]] const std::string& getText() const noexcept;
+
+        /** Function for setting if lines are wrapped to the width.
+
+            Note: Will apply the width of the widest line as min width, if not wrapped.
+
+            @param wrap     true to wrap lines
+        */
+        void setWordWrap(bool wrap);
+
+        /** Function for retrieving if lines are wrapped to the width.
+
+            @return    true if wrapped
+        */
+        [[nodiscard]] bool getWordWrap() const noexcept;
+
+        /** Function for retrieving the Color of the text.
+
+            @return    Current Color
+        */
+        [[nodiscard]] const Color& getColor() const;
+
+        /** Function for setting the Color of the text.
+
+            @param Color   text Color
+        */
+        void setColor(const Color& color);
+
+        /** Function for retrieving the layout of the text.
+
+            @return    layout
+        */
+        [[nodiscard]] const TextLayout& layout() const noexcept;
+
+    private:
+        // Callback function from Text (font changes).
+        void onTextUpdate() override;
+
+        // Breaks the lines at the new width.
+        void onSizeChange(const Size& size) override;
+
+        // Applies the layout width and the min size from the laid out lines.
+        void updateLayout();
+
+        // Shapes the lines inside the clip of the canvas.
+        void updateVisibleLines(const Canvas* canvas);
+
+    private:
+        TextLayout m_layout{};
+        Color m_color{0xf5f5f5ff};
+        bool m_wordWrap{true};
+
+        // Shaped lines [m_visibleFirst, m_visibleFirst + m_visibleLines.size()) of the last draw.
+        std::vector<ShapedText> m_visibleLines{};
+        std::size_t m_visibleFirst{0};
+        bool m_visibleValid{false};
+    };
+} // namespace pTK
+
+#endif // PTK_WIDGETS_TEXTAREA_HPP
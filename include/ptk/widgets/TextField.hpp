@@ -11,6 +11,7 @@
 // pTK Headers
 #include "ptk/core/Text.hpp"
 #include "ptk/core/Widget.hpp"
+#include "ptk/util/GapBuffer.hpp"
 #include "ptk/util/Vec2.hpp"
 
 namespace pTK
@@ -164,13 +165,28 @@ namespace pTK
         // Handles for keyboard input.
         void handleKeyPress(KeyCode keycode, uint8_t modifier);
         void removeFromText(int direction);
-        void moveCursor(int direction, std::size_t strSize, bool shouldDraw = false);
-        void moveCursorToPos(std::size_t pos, std::size_t strSize, bool shouldDraw = false);
+        void insertText(const char* text, std::size_t size);
+        void moveCursor(int direction, bool shouldDraw = false);
+        void moveCursorToPos(std::size_t pos, bool shouldDraw = false);
 
-        void handleInput(const std::unique_ptr<uint32_t[]>& data, std::size_t size, Text::Encoding encoding);
+        void handleInput(const InputEvent& evt);
+
+        // Byte position of the next and previous char.
+        [[nodiscard]] std::size_t nextCharPos(std::size_t pos) const;
+        [[nodiscard]] std::size_t prevCharPos(std::size_t pos) const;
+
+        // Sum of the advances in [first, last).
+        [[nodiscard]] float advanceBetween(std::size_t first, std::size_t last) const;
+
+        // Invalidates the caches of the text after an edit.
+        void textChanged();
+
+        // Shapes the part of the text inside the clip of the canvas.
+        void updateVisibleText(const Canvas* canvas);
 
     private:
         std::string m_placeholderText{};
+        ShapedText m_placeholderShaped{};
         Vec2f m_textPos{0.0f, 0.0f};
         Color m_textColor{0xFFFFFFFF};
         Color m_placeholderColor{0xF0F0F0FF};
@@ -184,7 +200,22 @@ namespace pTK
         float m_outlineThickness{0.0f};
 
         // Only supports UTF-8 for now.
-        std::string m_text{};
+        GapBuffer<char> m_buffer{};
+        GapBuffer<float> m_advances{}; // Advance of each byte (of the char on its first byte).
+        float m_textAdvance{0.0f};
+        float m_cursorAdvance{0.0f};
+
+        // Text (from m_buffer) created when requested.
+        mutable std::string m_text{};
+        mutable bool m_textValid{true};
+
+        // Shaped part of the text that was visible at the last draw, starts at the
+        // byte m_visibleFirst with the advance m_visibleAdvance (kept updated on edits).
+        std::size_t m_visibleFirst{0};
+        float m_visibleAdvance{0.0f};
+        float m_visibleLeft{0.0f};
+        float m_visibleRight{0.0f};
+        bool m_visibleValid{false};
     };
 } // namespace pTK
 
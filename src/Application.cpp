@@ -159,6 +159,45 @@ namespace pTK
         return false;
     }
 
+    void Application::setEventCoalescing(bool value) noexcept
+    {
+        m_handle->setEventCoalescing(value);
+    }
+
+    bool Application::eventCoalescing() const noexcept
+    {
+        return m_handle->eventCoalescing();
+    }
+
+    uint64_t Application::coalescedEventCount() const noexcept
+    {
+        return m_handle->coalescedEvents();
+    }
+
+    EventSources::id_type Application::addTimer(std::chrono::milliseconds delay, EventSources::timer_callback callback,
+                                                bool repeat)
+    {
+        return m_handle->eventSources().addTimer(delay, std::move(callback), repeat);
+    }
+
+    bool Application::removeTimer(EventSources::id_type id)
+    {
+        return m_handle->eventSources().removeTimer(id);
+    }
+
+    EventSources::id_type Application::addWatch(int fd, uint32_t events, EventSources::watch_callback callback)
+    {
+        if (!m_handle->supportsWatches())
+            throw PlatformError("File descriptor watchers are not supported on this platform");
+
+        return m_handle->eventSources().addWatch(fd, events, std::move(callback));
+    }
+
+    bool Application::removeWatch(EventSources::id_type id)
+    {
+        return m_handle->eventSources().removeWatch(id);
+    }
+
     void Application::eraseWindow(const_iterator it)
     {
         PTK_INFO("Removing window \"{}\"", it->second->getName());
@@ -206,17 +245,18 @@ namespace pTK
         if (window->isContentValid())
             return WaitForEvents; // Window can wait indefinitely here.
 
-        const std::size_t timeSinceDraw = window->timeSinceLastDraw();
-        const std::size_t frameTime = 1000 / window->targetRefreshRate();
-
-        if (timeSinceDraw >= frameTime)
+        // The deadline is kept in nanoseconds, but the platform waits in milliseconds.
+        // Rounding down and drawing when less than a millisecond is left keeps the
+        // frames on the deadlines without accumulating the truncation.
+        using namespace std::chrono;
+        const auto delay = duration_cast<milliseconds>(window->timeUntilFrame()).count();
+        if (delay <= 0)
         {
             window->drawContent();
             return WaitForEvents; // Window can wait indefinitely here.
         }
 
-        int delay = static_cast<int>(frameTime - timeSinceDraw); // Time before drawing should happen.
-        return WaitTimeoutForEvents(delay);                      // Can only wait maximum on "delay" time.
+        return WaitTimeoutForEvents(static_cast<int>(delay)); // Can only wait maximum on "delay" time.
     }
 
     int Application::standardMessageLoop()
@@ -248,8 +288,9 @@ namespace pTK
             int nextPollTime = -1;
             for (const auto& pair : *this)
             {
+                // Wait for the window with the closest frame.
                 int delay = WindowEventFrame(pair.second);
-                if (delay < eventPollTime || eventPollTime < 0)
+                if ((delay >= 0) && ((delay < nextPollTime) || (nextPollTime < 0)))
                     nextPollTime = delay;
             }
             eventPollTime = nextPollTime;
@@ -260,6 +301,10 @@ namespace pTK
 
     void Application::fetchEvents(int allowedTime)
     {
+        // Do not wait past the next timer.
+        EventSources& sources{m_handle->eventSources()};
+        allowedTime = sources.timeout(allowedTime);
+
         if (allowedTime < 0)
         {
             // Waiting indefinitely is fine.
@@ -275,6 +320,8 @@ namespace pTK
             // Can not wait for a specified amount of time.
             m_handle->waitEventsTimeout(static_cast<uint32_t>(allowedTime));
         }
+
+        sources.dispatchTimers();
     }
 
     int Application::run()
@@ -342,6 +389,11 @@ namespace pTK
         return s_Instance;
     }
 
+    bool Application::Exists() noexcept
+    {
+        return s_Instance != nullptr;
+    }
+
     void Application::clearWindows()
     {
         for (auto it = cbegin(); it != cend(); ++it)
@@ -10,32 +10,66 @@
 
 // spdlog Headers
 PTK_DISABLE_WARN_BEGIN()
+#include "spdlog/async.h"
 #include "spdlog/sinks/stdout_color_sinks.h"
 PTK_DISABLE_WARN_END()
 
+// C++ Headers
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <utility>
+
 namespace pTK
 {
-    std::shared_ptr<spdlog::logger> Log::s_logger;
+    // Max number of queued messages, the oldest are dropped when full (the caller never blocks).
+    static constexpr std::size_t s_logQueueSize{8192};
+
+    // Set when the logger has been created.
+    static std::atomic<bool> s_created{false};
+
+    static void ShutdownLogging()
+    {
+        // Writes the queued messages and stops the logging thread.
+        spdlog::shutdown();
+    }
+
+    static std::shared_ptr<spdlog::logger> CreateLogger()
+    {
+        // Messages are formatted on the calling thread and written by a background thread.
+        spdlog::init_thread_pool(s_logQueueSize, 1);
+        spdlog::set_pattern("%^[%Y-%m-%d %T] %n: %v%$");
+        auto sink{std::make_shared<spdlog::sinks::stdout_color_sink_mt>()};
+        auto logger{std::make_shared<spdlog::async_logger>("pTK", std::move(sink), spdlog::thread_pool(),
+                                                           spdlog::async_overflow_policy::overrun_oldest)};
+        spdlog::initialize_logger(logger);
+
+        // Runtime level, lowest of the compile-time levels (messages below are already compiled out).
+        const int level{std::min({PTK_LOG_LEVEL_CORE, PTK_LOG_LEVEL_PLATFORM, PTK_LOG_LEVEL_WIDGETS})};
+        logger->set_level(static_cast<spdlog::level::level_enum>(level));
+        logger->flush_on(spdlog::level::err);
+        std::atexit(ShutdownLogging);
+
+        s_created = true;
+        return logger;
+    }
 
     void Log::init()
     {
-        static bool initialized = false;
+        const bool created{s_created};
+        getLogger();
 
-        if (initialized)
-        {
+        if (created)
             PTK_WARN("Logger have already been initialized!");
-            return;
-        }
-
-        spdlog::set_pattern("%^[%Y-%m-%d %T] %n: %v%$");
-        s_logger = spdlog::stdout_color_mt("pTK");
-        s_logger->set_level(spdlog::level::debug);
-        initialized = true;
-        PTK_INFO("Initialized Logger.");
+        else
+            PTK_INFO("Initialized Logger.");
     }
 
     std::shared_ptr<spdlog::logger>& Log::getLogger()
     {
-        return s_logger;
+        // Created on first use, from any thread (the initialization of a function-local static is thread safe).
+        // Headless windows can be used without an Application, which initializes the logger.
+        static std::shared_ptr<spdlog::logger> logger{CreateLogger()};
+        return logger;
     }
 } // namespace pTK
@@ -13,8 +13,41 @@
 // pTK Headers
 #include "ptk/core/Defines.hpp"
 
+// Log levels (same values as spdlog::level).
+#define PTK_LOG_LEVEL_TRACE 0
+#define PTK_LOG_LEVEL_DEBUG 1
+#define PTK_LOG_LEVEL_INFO 2
+#define PTK_LOG_LEVEL_WARN 3
+#define PTK_LOG_LEVEL_ERROR 4
+#define PTK_LOG_LEVEL_CRITICAL 5
+#define PTK_LOG_LEVEL_OFF 6
+
+// Compile-time minimum level per subsystem, set by the build.
+// Messages below the level of the subsystem are compiled out, arguments are not evaluated.
+#ifndef PTK_LOG_LEVEL
+    #ifdef PTK_DEBUG
+        #define PTK_LOG_LEVEL PTK_LOG_LEVEL_TRACE
+    #else
+        #define PTK_LOG_LEVEL PTK_LOG_LEVEL_WARN
+    #endif
+#endif
+#ifndef PTK_LOG_LEVEL_CORE
+    #define PTK_LOG_LEVEL_CORE PTK_LOG_LEVEL
+#endif
+#ifndef PTK_LOG_LEVEL_PLATFORM
+    #define PTK_LOG_LEVEL_PLATFORM PTK_LOG_LEVEL
+#endif
+#ifndef PTK_LOG_LEVEL_WIDGETS
+    #define PTK_LOG_LEVEL_WIDGETS PTK_LOG_LEVEL
+#endif
+
+// Subsystem of the translation unit, set by the build (defaults to core).
+#ifndef PTK_LOG_SUBSYSTEM_LEVEL
+    #define PTK_LOG_SUBSYSTEM_LEVEL PTK_LOG_LEVEL_CORE
+#endif
+
 // Enable Logging
-#ifdef PTK_DEBUG
+#ifdef PTK_ENABLE_LOG
 
     // spdlog Headers
     PTK_DISABLE_WARN_BEGIN()
@@ -32,19 +65,20 @@
             static void init();
 
             static PTK_API std::shared_ptr<spdlog::logger>& getLogger();
-
-        private:
-            static std::shared_ptr<spdlog::logger> s_logger;
         };
     }
 
+    #define PTK_LOG_ENABLED(level) (PTK_LOG_SUBSYSTEM_LEVEL <= (level))
+    #define PTK_LOG(level, func, ...) do { if constexpr (PTK_LOG_ENABLED(level)) { pTK::Log::getLogger()->func(__VA_ARGS__); } } while (false)
+
     #define PTK_INIT_LOGGING(...) pTK::Log::init(__VA_ARGS__)
-    #define PTK_WARN(...)   pTK::Log::getLogger()->warn(__VA_ARGS__)
-    #define PTK_ERROR(...)  pTK::Log::getLogger()->error(__VA_ARGS__)
-    #define PTK_TRACE(...)  pTK::Log::getLogger()->trace(__VA_ARGS__)
-    #define PTK_INFO(...)   pTK::Log::getLogger()->info(__VA_ARGS__)
-    #define PTK_FATAL(...)  pTK::Log::getLogger()->critical(__VA_ARGS__)
+    #define PTK_WARN(...)   PTK_LOG(PTK_LOG_LEVEL_WARN, warn, __VA_ARGS__)
+    #define PTK_ERROR(...)  PTK_LOG(PTK_LOG_LEVEL_ERROR, error, __VA_ARGS__)
+    #define PTK_TRACE(...)  PTK_LOG(PTK_LOG_LEVEL_TRACE, trace, __VA_ARGS__)
+    #define PTK_INFO(...)   PTK_LOG(PTK_LOG_LEVEL_INFO, info, __VA_ARGS__)
+    #define PTK_FATAL(...)  PTK_LOG(PTK_LOG_LEVEL_CRITICAL, critical, __VA_ARGS__)
 #else
+    #define PTK_LOG_ENABLED(level) false
     #define PTK_INIT_LOGGING(...)
     #define PTK_WARN(...)
     #define PTK_ERROR(...)
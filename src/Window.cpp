@@ -11,11 +11,16 @@
 // pTK Headers
 #include "ptk/Application.hpp"
 #include "ptk/Window.hpp"
+#include "ptk/core/Profiler.hpp"
 #include "ptk/platform/ContextFactory.hpp"
 
 // Skia Headers
 PTK_DISABLE_WARN_BEGIN()
 #include "include/core/SkData.h"
+#include "include/core/SkPixmap.h"
+#include "include/core/SkRegion.h"
+#include "include/core/SkStream.h"
+#include "include/encode/SkPngEncoder.h"
 PTK_DISABLE_WARN_END()
 
 namespace pTK
@@ -53,8 +58,8 @@ namespace pTK
     Window::~Window()
     {
         // Remove the Window from the Application if it exists, in case it is still there.
-        if (auto app = Application::Get())
-            app->removeWindow(this);
+        if (Application::Exists())
+            Application::Get()->removeWindow(this);
 
         m_context.reset();
         m_handle.reset();
@@ -62,7 +67,7 @@ namespace pTK
         PTK_INFO("Destroyed Window");
     }
 
-    void Window::onAdd(const value_type&)
+    void Window::fitChildren()
     {
         const Size minLayoutSize{calcMinSize()};
         setMinSize(minLayoutSize);
@@ -92,22 +97,16 @@ namespace pTK
         invalidate();
     }
 
-    void Window::onChildUpdate(size_type)
+    void Window::onChildUpdate(size_type index)
     {
+        invalidateChildLimits(index);
         refitContent(getSize(), {0, 0});
     }
 
     void Window::runCommands()
     {
-        // Switch buffer.
-        CommandBuffer<void()> buffer{};
-        {
-            std::lock_guard<std::mutex> lock{m_commandBufferMutex};
-            buffer = std::move(m_commandBuffer);
-        }
-
-        // Run commands.
-        buffer.batchInvoke();
+        PTK_PROFILE_ZONE("Window::runCommands");
+        m_commands.run();
     }
 
     void Window::invalidate()
@@ -149,6 +148,7 @@ namespace pTK
             m_context->resize(scaledSize);
 
         refitContent(size, {0, 0});
+        addDamage({{0, 0}, size});
         invalidate();
     }
 
@@ -157,12 +157,20 @@ namespace pTK
         refitContent(getSize(), {0, 0});
     }
 
-    void Window::regionInvalidated(const PaintEvent&)
+    void Window::addDamage(const Rect& rect)
+    {
+        // Damage outside the window does not need to be painted.
+        m_damage.add(rect.intersected({{0, 0}, getSize()}));
+    }
+
+    void Window::regionInvalidated(const PaintEvent& evt)
     {
-        // Just assume that the entire window needs to be painted here (for now).
-        // Another (better) solution would be to find what children needs to be
-        // painted and just paint those. But currently there isn't any support
-        // for rendering individual widgets anyway.
+        // If the content has not been invalidated by the Window itself, the event
+        // is from the platform (window exposed) and that region must be repainted.
+        // Otherwise, the damage reported by the children is what needs to be painted.
+        if (isContentValid())
+            addDamage({evt.pos, evt.size});
+
         paint();
     }
 
@@ -177,8 +185,25 @@ namespace pTK
         m_handle->setLimits(limits.min, limits.max);
     }
 
+    static Rect ToDeviceRect(const Rect& rect, const Vec2f& scale)
+    {
+        const SkRect skRect{SkRect::MakeXYWH(static_cast<float>(rect.pos.x) * scale.x,
+                                             static_cast<float>(rect.pos.y) * scale.y,
+                                             static_cast<float>(rect.size.width) * scale.x,
+                                             static_cast<float>(rect.size.height) * scale.y)};
+        const SkIRect device{skRect.roundOut()};
+        return {{device.x(), device.y()},
+                {static_cast<Size::value_type>(device.width()), static_cast<Size::value_type>(device.height())}};
+    }
+
     void Window::paint()
     {
+        PTK_PROFILE_ZONE("Window::paint");
+
+        // The window might have moved to another monitor.
+        m_scheduler.setRefreshRate(m_handle->refreshRate());
+        m_scheduler.beginFrame();
+
         ContextBase* context{getContext()};
         sk_sp<SkSurface> surface = context->surface();
         SkCanvas* skCanvas{surface->getCanvas()};
@@ -189,38 +214,96 @@ namespace pTK
         matrix.setScale(scale.x, scale.y);
         skCanvas->setMatrix(matrix);
 
-        // Will paint background and then children.
+        // Without any reported damage, or if the context does not keep its content,
+        // the whole window must be painted.
+        const bool partial{context->preservesContent() && !m_damage.empty()};
+
+        // Region that will be presented by the context (in device coordinates).
+        DamageRegion presented{};
+        if (partial)
+        {
+            for (const Rect& rect : m_damage)
+                presented.add(ToDeviceRect(rect, scale));
+        }
+        else
+            presented.add({{0, 0}, context->getSize()});
+
+        skCanvas->save();
+        if (partial)
+        {
+            // The clip is set in device coordinates (the scale matrix is not applied).
+            SkRegion clip{};
+            for (const Rect& rect : presented)
+                clip.op(SkIRect::MakeXYWH(rect.pos.x, rect.pos.y, static_cast<int>(rect.size.width),
+                                          static_cast<int>(rect.size.height)),
+                        SkRegion::kUnion_Op);
+            skCanvas->clipRegion(clip);
+        }
+
+        // Will paint background and then children (that intersects the clip).
         Canvas canvas{skCanvas};
-        onDraw(&canvas);
+        {
+            PTK_PROFILE_ZONE("Window::onDraw");
+            onDraw(&canvas);
+        }
+        skCanvas->restore();
+        m_damage.clear();
 
-        surface->flushAndSubmit();
-        m_context->swapBuffers();
+        {
+            PTK_PROFILE_ZONE("SkSurface::flushAndSubmit");
+            surface->flushAndSubmit();
+        }
+        {
+            PTK_PROFILE_ZONE("ContextBase::swapBuffers");
+            m_context->swapBuffers(presented);
+        }
 
         // Painting is done, enable invalidation again.
         markContentValid();
     }
 
+    void Window::renderFrame()
+    {
+        paint();
+    }
+
+    static SkImageInfo FrameImageInfo(const Size& size)
+    {
+        return SkImageInfo::Make(static_cast<int>(size.width), static_cast<int>(size.height), kRGBA_8888_SkColorType,
+                                 kUnpremul_SkAlphaType);
+    }
+
+    std::vector<uint8_t> Window::readPixels() const
+    {
+        const SkImageInfo info{FrameImageInfo(getContentSize())};
+        std::vector<uint8_t> pixels(info.computeMinByteSize());
+        if (pixels.empty() || !m_context->surface()->readPixels(info, pixels.data(), info.minRowBytes(), 0, 0))
+            return {};
+
+        return pixels;
+    }
+
+    std::vector<uint8_t> Window::encodePNG() const
+    {
+        std::vector<uint8_t> pixels{readPixels()};
+        if (pixels.empty())
+            return {};
+
+        const SkImageInfo info{FrameImageInfo(getContentSize())};
+        const SkPixmap pixmap{info, pixels.data(), info.minRowBytes()};
+        SkDynamicMemoryWStream stream{};
+        if (!SkPngEncoder::Encode(&stream, pixmap, {}))
+            return {};
+
+        const sk_sp<SkData> data{stream.detachAsData()};
+        return {data->bytes(), data->bytes() + data->size()};
+    }
+
     void Window::markContentValid()
     {
         m_contentInvalidated = false;
         m_lastDrawTime = std::chrono::steady_clock::now();
-
-#if 1
-        using namespace std::chrono;
-        static time_point<steady_clock> last = steady_clock::now();
-        time_point<steady_clock> now = std::chrono::steady_clock::now();
-
-        auto elapsed = duration_cast<milliseconds>(now - last).count();
-        static int fps = 1;
-        if (elapsed >= 1000)
-        {
-            PTK_INFO("Window: \"{}\" [DRAWING] FPS = {}", getName(), fps);
-            last = m_lastDrawTime;
-            fps = 1;
-        }
-        else
-            ++fps;
-#endif
+        m_scheduler.endFrame(m_lastDrawTime);
     }
 
     void Window::setSizePolicy(SizePolicy policy)
@@ -290,21 +373,21 @@ namespace pTK
                 if (image->readPixels(imageInfo, pixelData.get(), imageInfo.minRowBytes(), 0, 0))
                     return m_handle->setIcon(static_cast<int32_t>(image->width()),
                                              static_cast<int32_t>(image->height()), pixelData.get());
-#ifdef PTK_DEBUG
+#ifdef PTK_ENABLE_LOG
                 else
                 {
                     PTK_WARN("Failed to convert image \"{}\" to a RGBA format", path);
                 }
 #endif
             }
-#ifdef PTK_DEBUG
+#ifdef PTK_ENABLE_LOG
             else
             {
                 PTK_WARN("Could not decode image \"{}\"", path);
             }
 #endif
         }
-#ifdef PTK_DEBUG
+#ifdef PTK_ENABLE_LOG
         else
         {
             PTK_WARN("Failed to open \"{}\"", path);
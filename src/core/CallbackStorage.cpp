@@ -8,8 +8,28 @@
 // pTK Headers
 #include "ptk/core/CallbackStorage.hpp"
 
+// C++ Headers
+#include <mutex>
+#include <unordered_map>
+
 namespace pTK
 {
+    CallbackIndexGen::index_type CallbackIndexGen::Register(std::type_index type)
+    {
+        // Only used once per type, the index is cached by GetIndex().
+        static std::mutex s_mutex{};
+        static std::unordered_map<std::type_index, index_type> s_indices{};
+
+        std::lock_guard<std::mutex> lock{s_mutex};
+        auto it = s_indices.find(type);
+        if (it != s_indices.end())
+            return it->second;
+
+        const index_type index{s_indices.size()};
+        s_indices.emplace(type, index);
+        return index;
+    }
+
     // CallbackStorage class static definitions.
     uint64_t CallbackStorage::s_idCounter{1};
 } // namespace pTK
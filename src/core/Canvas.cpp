@@ -12,7 +12,6 @@
 PTK_DISABLE_WARN_BEGIN()
 #include "include/core/SkCanvas.h"
 #include "include/core/SkFont.h"
-#include "include/core/SkFontMetrics.h"
 #include "include/core/SkTypeface.h"
 PTK_DISABLE_WARN_END()
 
@@ -48,60 +47,6 @@ namespace pTK
         return SkTextEncoding::kUTF8;
     }
 
-    static std::size_t SpaceCount(const Text::StrData& data)
-    {
-        std::size_t count{0};
-
-        const void* ptr = data.text;
-
-        for (std::size_t i{0}; i < data.size; ++i)
-        {
-            uint32_t ch{0};
-
-            if (data.encoding == Text::Encoding::UTF8)
-            {
-                const auto* c = static_cast<const uint8_t*>(ptr);
-                ch = static_cast<uint32_t>(c[i]);
-            }
-
-            if (data.encoding == Text::Encoding::UTF16)
-            {
-                const auto* c = static_cast<const uint16_t*>(ptr);
-                ch = static_cast<uint32_t>(c[i]);
-            }
-
-            if (data.encoding == Text::Encoding::UTF32)
-            {
-                const auto* c = static_cast<const uint32_t*>(ptr);
-                ch = static_cast<uint32_t>(c[i]);
-            }
-
-            if (ch == 0x20)
-                ++count;
-            else
-                break;
-        }
-
-        return count;
-    }
-
-    static float StartSpaceOffset(const SkFont& font, const Text::StrData& data)
-    {
-        // This function only handles " " for now.
-        // TODO: Support for no-break space should be added.
-
-        float offset{0.0f};
-        std::size_t spaceCount{SpaceCount(data)};
-
-        if (spaceCount > 0)
-        {
-            SkRect tmp{};
-            offset = font.measureText(data.text, spaceCount, EncodingToSkTextEncoding(data.encoding), &tmp);
-        }
-
-        return offset;
-    }
-
     static constexpr std::size_t EncodingByteSize(Text::Encoding encoding)
     {
         if (encoding == Text::Encoding::UTF16)
@@ -112,13 +57,6 @@ namespace pTK
         return 1;
     }
 
-    static float CapHeight(const SkFont* font)
-    {
-        SkFontMetrics metrics{};
-        font->getMetrics(&metrics);
-        return std::abs(metrics.fCapHeight);
-    }
-
     ///////////////////////////////////////////////////////////////////////////////
 
     void Canvas::drawRect(Point pos, Size size, Color color) const
@@ -184,54 +122,69 @@ namespace pTK
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    static ShapedText ShapeStrData(const Text::StrData& data, const SkFont* font)
+    {
+        const std::size_t byteLength{data.size * EncodingByteSize(data.encoding)};
+        return ShapedText{data.text, byteLength, EncodingToSkTextEncoding(data.encoding), *font};
+    }
+
     float Canvas::drawTextLine(const Text::StrData& data, const Color& color, const Vec2f& pos,
                                const SkFont* font) const
+    {
+        return drawShapedText(ShapeStrData(data, font), color, pos);
+    }
+
+    float Canvas::drawTextLine(const Text::StrData& data, const Color& color, const Vec2f& pos, const SkFont* font,
+                               float outlineSize, const Color& outColor) const
+    {
+        return drawShapedText(ShapeStrData(data, font), color, pos, outlineSize, outColor);
+    }
+
+    float Canvas::drawTextLineWithPaint(const Text::StrData& data, const Vec2f& pos, const SkFont* font,
+                                        SkPaint* paint) const
+    {
+        return drawShapedTextWithPaint(ShapeStrData(data, font), pos, paint);
+    }
+
+    float Canvas::drawShapedText(const ShapedText& text, const Color& color, const Vec2f& pos) const
     {
         SkPaint paint{ToSkPaint(color)};
         paint.setStyle(SkPaint::kStrokeAndFill_Style);
 
-        return drawTextLineWithPaint(data, pos, font, &paint);
+        return drawShapedTextWithPaint(text, pos, &paint);
     }
 
-    float Canvas::drawTextLine(const Text::StrData& data, const Color& color, const Vec2f& pos, const SkFont* font,
-                               float outlineSize, const Color& outColor) const
+    float Canvas::drawShapedText(const ShapedText& text, const Color& color, const Vec2f& pos, float outlineSize,
+                                 const Color& outColor) const
     {
         if (!(outlineSize > 0.0f))
-            return drawTextLine(data, color, pos, font);
+            return drawShapedText(text, color, pos);
 
         SkPaint paint{ToSkPaint(color)};
         paint.setStrokeWidth(outlineSize);
         paint.setStyle(SkPaint::kFill_Style);
-        float advance = drawTextLineWithPaint(data, pos, font, &paint);
+        float advance = drawShapedTextWithPaint(text, pos, &paint);
 
         paint.setARGB(outColor.a, outColor.r, outColor.g, outColor.b);
         paint.setStyle(SkPaint::kStroke_Style);
-        drawTextLineWithPaint(data, pos, font, &paint);
+        drawShapedTextWithPaint(text, pos, &paint);
 
         return advance;
     }
 
-    float Canvas::drawTextLineWithPaint(const Text::StrData& data, const Vec2f& pos, const SkFont* font,
-                                        SkPaint* paint) const
+    float Canvas::drawShapedTextWithPaint(const ShapedText& text, const Vec2f& pos, SkPaint* paint) const
     {
-        SkRect bounds{};
-
-        std::size_t byteLength = data.size * EncodingByteSize(data.encoding);
-        float advance = font->measureText(data.text, byteLength, EncodingToSkTextEncoding(data.encoding), &bounds);
-
 #ifdef PTK_DRAW_TEXT_RECT
         Point p{static_cast<int>(pos.x), static_cast<int>(pos.y)};
-        Size s{static_cast<Size::value_type>(std::ceil(advance)),
-               static_cast<Size::value_type>(std::ceil(CapHeight(font)))};
+        Size s{static_cast<Size::value_type>(std::ceil(text.advance())),
+               static_cast<Size::value_type>(std::ceil(text.offset().y))};
         drawRect(p, s, Color{0xFF1212AA});
 #endif
 
-        SkScalar x = pos.x + StartSpaceOffset(*font, data) + (-1 * bounds.x());
-        SkScalar y = pos.y + CapHeight(font);
+        if (!text.empty())
+            skCanvas->drawTextBlob(text.blob(), pos.x + text.offset().x, pos.y + text.offset().y, *paint);
 
-        skCanvas->drawSimpleText(data.text, byteLength, EncodingToSkTextEncoding(data.encoding), x, y, *font, *paint);
-
-        return advance;
+        return text.advance();
     }
 
     void Canvas::drawImage(Point pos, Size size, const SkImage* image) const
@@ -247,6 +200,28 @@ namespace pTK
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    bool Canvas::quickReject(Point pos, Size size) const
+    {
+        SkPoint skPos{ToSkPoint(pos)};
+        SkPoint skSize{ToSkPoint(size)};
+        skSize += skPos; // skia needs the size to be pos+size.
+
+        SkRect rect{};
+        rect.set(skPos, skSize);
+        return skCanvas->quickReject(rect);
+    }
+
+    void Canvas::clipRect(Point pos, Size size) const
+    {
+        SkPoint skPos{ToSkPoint(pos)};
+        SkPoint skSize{ToSkPoint(size)};
+        skSize += skPos; // skia needs the size to be pos+size.
+
+        SkRect rect{};
+        rect.set(skPos, skSize);
+        skCanvas->clipRect(rect);
+    }
+
     void Canvas::save() const
     {
         skCanvas->save();
@@ -0,0 +1,73 @@
+//
+//  core/DamageRegion.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// pTK Headers
+#include "ptk/core/DamageRegion.hpp"
+
+// C++ Headers
+#include <algorithm>
+
+namespace pTK
+{
+    DamageRegion::DamageRegion(size_type maxRects)
+        : m_maxRects{(maxRects > 0) ? maxRects : 1}
+    {}
+
+    void DamageRegion::add(const Rect& rect)
+    {
+        if (rect.isEmpty())
+            return;
+
+        m_bounds = m_bounds.united(rect);
+
+        // Merge with every rectangle that overlaps, the merged rectangle might
+        // then overlap others, hence the loop.
+        Rect merged{rect};
+        bool changed{true};
+        while (changed)
+        {
+            changed = false;
+            for (auto it = m_rects.begin(); it != m_rects.end(); ++it)
+            {
+                if (it->contains(merged))
+                    return; // Already damaged.
+
+                if (merged.intersects(*it))
+                {
+                    merged = merged.united(*it);
+                    m_rects.erase(it);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+
+        m_rects.push_back(merged);
+
+        if (m_rects.size() > m_maxRects)
+        {
+            m_rects.clear();
+            m_rects.push_back(m_bounds);
+        }
+    }
+
+    void DamageRegion::clear() noexcept
+    {
+        m_rects.clear();
+        m_bounds = {};
+    }
+
+    bool DamageRegion::intersects(const Rect& rect) const noexcept
+    {
+        if (!m_bounds.intersects(rect))
+            return false;
+
+        return std::any_of(m_rects.cbegin(), m_rects.cend(), [&rect](const Rect& item) {
+            return item.intersects(rect);
+        });
+    }
+} // namespace pTK
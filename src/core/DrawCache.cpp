@@ -0,0 +1,110 @@
+//
+//  core/DrawCache.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// pTK Headers
+#include "ptk/core/DrawCache.hpp"
+#include "ptk/core/Drawable.hpp"
+
+// C++ Headers
+#include <cmath>
+
+// Skia Headers
+PTK_DISABLE_WARN_BEGIN()
+#include "include/core/SkCanvas.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkPicture.h"
+#include "include/core/SkPictureRecorder.h"
+#include "include/core/SkSurface.h"
+PTK_DISABLE_WARN_END()
+
+namespace pTK
+{
+    static SkRect ToSkRect(const Rect& rect)
+    {
+        return SkRect::MakeXYWH(static_cast<float>(rect.pos.x), static_cast<float>(rect.pos.y),
+                                static_cast<float>(rect.size.width), static_cast<float>(rect.size.height));
+    }
+
+    static Vec2f DeviceScale(const Canvas* canvas)
+    {
+        const SkMatrix matrix{canvas->skCanvas->getTotalMatrix()};
+        return {matrix.getScaleX(), matrix.getScaleY()};
+    }
+
+    DrawCache::DrawCache(CachePolicy policy) noexcept
+        : m_policy{policy}
+    {}
+
+    DrawCache::~DrawCache() = default;
+
+    void DrawCache::draw(Canvas* canvas, const Rect& bounds, Drawable& drawable)
+    {
+        if ((m_policy == CachePolicy::None) || bounds.isEmpty())
+        {
+            drawable.onDraw(canvas);
+            return;
+        }
+
+        // Raster content is only valid for the scale it was rendered at.
+        const bool scaleChanged{(m_policy == CachePolicy::Raster) && (DeviceScale(canvas) != m_scale)};
+        if (m_valid && (bounds == m_bounds) && !scaleChanged)
+        {
+            ++m_stats.hits;
+            replay(canvas);
+            return;
+        }
+
+        ++m_stats.misses;
+        m_valid = record(canvas, bounds, drawable);
+        if (m_valid)
+            replay(canvas);
+        else
+            drawable.onDraw(canvas);
+    }
+
+    bool DrawCache::record(Canvas* canvas, const Rect& bounds, Drawable& drawable)
+    {
+        m_picture.reset();
+        m_image.reset();
+        m_bounds = bounds;
+
+        // Recorded without the clip of canvas, the whole bounds are needed for replays.
+        if (m_policy == CachePolicy::Picture)
+        {
+            SkPictureRecorder recorder{};
+            Canvas recording{recorder.beginRecording(ToSkRect(bounds))};
+            drawable.onDraw(&recording);
+            m_picture = recorder.finishRecordingAsPicture();
+            return static_cast<bool>(m_picture);
+        }
+
+        m_scale = DeviceScale(canvas);
+        const auto width{static_cast<int>(std::ceil(static_cast<float>(bounds.size.width) * m_scale.x))};
+        const auto height{static_cast<int>(std::ceil(static_cast<float>(bounds.size.height) * m_scale.y))};
+        sk_sp<SkSurface> surface{SkSurface::MakeRasterN32Premul(width, height)};
+        if (!surface)
+            return false;
+
+        SkCanvas* skCanvas{surface->getCanvas()};
+        skCanvas->clear(SK_ColorTRANSPARENT);
+        skCanvas->scale(m_scale.x, m_scale.y);
+        skCanvas->translate(-static_cast<float>(bounds.pos.x), -static_cast<float>(bounds.pos.y));
+
+        Canvas rendering{skCanvas};
+        drawable.onDraw(&rendering);
+        m_image = surface->makeImageSnapshot();
+        return static_cast<bool>(m_image);
+    }
+
+    void DrawCache::replay(Canvas* canvas) const
+    {
+        if (m_picture)
+            canvas->skCanvas->drawPicture(m_picture);
+        else if (m_image)
+            canvas->drawImage(m_bounds.pos, m_bounds.size, m_image.get());
+    }
+} // namespace pTK
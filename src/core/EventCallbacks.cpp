@@ -8,50 +8,53 @@
 // pTK Headers
 #include "ptk/core/EventCallbacks.hpp"
 
+// C++ Headers
+#include <utility>
+
 namespace pTK
 {
-    uint64_t EventCallbacks::onKey(const std::function<bool(const KeyEvent&)>& callback)
+    uint64_t EventCallbacks::onKey(InplaceFunction<bool(const KeyEvent&)> callback)
     {
-        return addListener<KeyEvent>(callback);
+        return addListener<KeyEvent>(std::move(callback));
     }
 
-    uint64_t EventCallbacks::onInput(const std::function<bool(const InputEvent&)>& callback)
+    uint64_t EventCallbacks::onInput(InplaceFunction<bool(const InputEvent&)> callback)
     {
-        return addListener<InputEvent>(callback);
+        return addListener<InputEvent>(std::move(callback));
     }
 
-    uint64_t EventCallbacks::onHover(const std::function<bool(const MotionEvent&)>& callback)
+    uint64_t EventCallbacks::onHover(InplaceFunction<bool(const MotionEvent&)> callback)
     {
-        return addListener<MotionEvent>(callback);
+        return addListener<MotionEvent>(std::move(callback));
     }
 
-    uint64_t EventCallbacks::onEnter(const std::function<bool(const EnterEvent&)>& callback)
+    uint64_t EventCallbacks::onEnter(InplaceFunction<bool(const EnterEvent&)> callback)
     {
-        return addListener<EnterEvent>(callback);
+        return addListener<EnterEvent>(std::move(callback));
     }
 
-    uint64_t EventCallbacks::onLeave(const std::function<bool(const LeaveEvent&)>& callback)
+    uint64_t EventCallbacks::onLeave(InplaceFunction<bool(const LeaveEvent&)> callback)
     {
-        return addListener<LeaveEvent>(callback);
+        return addListener<LeaveEvent>(std::move(callback));
     }
 
-    uint64_t EventCallbacks::onLeaveClick(const std::function<bool(const LeaveClickEvent&)>& callback)
+    uint64_t EventCallbacks::onLeaveClick(InplaceFunction<bool(const LeaveClickEvent&)> callback)
     {
-        return addListener<LeaveClickEvent>(callback);
+        return addListener<LeaveClickEvent>(std::move(callback));
     }
 
-    uint64_t EventCallbacks::onScroll(const std::function<bool(const ScrollEvent&)>& callback)
+    uint64_t EventCallbacks::onScroll(InplaceFunction<bool(const ScrollEvent&)> callback)
     {
-        return addListener<ScrollEvent>(callback);
+        return addListener<ScrollEvent>(std::move(callback));
     }
 
-    uint64_t EventCallbacks::onClick(const std::function<bool(const ClickEvent&)>& callback)
+    uint64_t EventCallbacks::onClick(InplaceFunction<bool(const ClickEvent&)> callback)
     {
-        return addListener<ClickEvent>(callback);
+        return addListener<ClickEvent>(std::move(callback));
     }
 
-    uint64_t EventCallbacks::onRelease(const std::function<bool(const ReleaseEvent&)>& callback)
+    uint64_t EventCallbacks::onRelease(InplaceFunction<bool(const ReleaseEvent&)> callback)
     {
-        return addListener<ReleaseEvent>(callback);
+        return addListener<ReleaseEvent>(std::move(callback));
     }
 } // namespace pTK
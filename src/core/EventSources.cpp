@@ -0,0 +1,152 @@
+//
+//  core/EventSources.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// pTK Headers
+#include "ptk/core/EventSources.hpp"
+
+// C++ Headers
+#include <algorithm>
+#include <limits>
+
+namespace pTK
+{
+    bool EventSources::Later(const Timer& lhs, const Timer& rhs) noexcept
+    {
+        // Ties are ordered by id, timers with the same deadline run in the order they were added.
+        if (lhs.deadline != rhs.deadline)
+            return lhs.deadline > rhs.deadline;
+        return lhs.id > rhs.id;
+    }
+
+    void EventSources::pushTimer(Timer&& timer)
+    {
+        m_timers.push_back(std::move(timer));
+        std::push_heap(m_timers.begin(), m_timers.end(), Later);
+    }
+
+    EventSources::id_type EventSources::addTimer(std::chrono::milliseconds delay, timer_callback callback, bool repeat,
+                                                 time_point now)
+    {
+        const clock_type::duration interval{std::max(delay, std::chrono::milliseconds{0})};
+        const id_type id{m_nextId++};
+        pushTimer(Timer{now + interval, interval, id, repeat, std::move(callback)});
+        return id;
+    }
+
+    bool EventSources::removeTimer(id_type id)
+    {
+        auto it = std::find_if(m_timers.begin(), m_timers.end(), [id](const Timer& timer) { return timer.id == id; });
+        if (it != m_timers.end())
+        {
+            m_timers.erase(it);
+            std::make_heap(m_timers.begin(), m_timers.end(), Later);
+            return true;
+        }
+
+        // Timer might be in the middle of being run, it is then marked as removed.
+        auto dueIt = std::find_if(m_due.begin(), m_due.end(), [id](const Timer& timer) { return timer.id == id; });
+        if (dueIt != m_due.end())
+        {
+            dueIt->id = 0;
+            return true;
+        }
+
+        return false;
+    }
+
+    std::size_t EventSources::dispatchTimers(time_point now)
+    {
+        if (m_timers.empty() || (m_timers.front().deadline > now))
+            return 0;
+
+        // Take all the due timers first, timers added by the callbacks
+        // (or repeating timers with a zero interval) will wait until the next call.
+        std::vector<Timer> due{std::move(m_due)};
+        due.clear();
+        while (!m_timers.empty() && (m_timers.front().deadline <= now))
+        {
+            std::pop_heap(m_timers.begin(), m_timers.end(), Later);
+            due.push_back(std::move(m_timers.back()));
+            m_timers.pop_back();
+        }
+        m_due = std::move(due);
+
+        std::size_t count{0};
+        for (std::size_t i{0}; i < m_due.size(); ++i)
+        {
+            if (m_due[i].id == 0)
+                continue;
+
+            // The callback might remove timers, call a copy.
+            timer_callback callback{m_due[i].callback};
+            callback();
+            ++count;
+
+            Timer& timer{m_due[i]};
+            if (timer.repeat && (timer.id != 0))
+            {
+                // Missed runs are skipped instead of being run back to back.
+                timer.deadline += timer.interval;
+                if (timer.deadline <= now)
+                    timer.deadline = now + timer.interval;
+                pushTimer(std::move(timer));
+            }
+            timer.id = 0;
+        }
+        m_due.clear();
+
+        return count;
+    }
+
+    int EventSources::timeout(int allowed, time_point now) const
+    {
+        if (m_timers.empty())
+            return allowed;
+
+        const time_point deadline{m_timers.front().deadline};
+        if (deadline <= now)
+            return 0;
+
+        // Rounded up, waking up before the deadline would only wait again.
+        const auto left{std::chrono::ceil<std::chrono::milliseconds>(deadline - now).count()};
+        const int ms{static_cast<int>(std::min<decltype(left)>(left, std::numeric_limits<int>::max()))};
+        return (allowed < 0) ? ms : std::min(allowed, ms);
+    }
+
+    EventSources::id_type EventSources::addWatch(int fd, uint32_t events, watch_callback callback)
+    {
+        const id_type id{m_nextId++};
+        m_watches.push_back(Watch{id, fd, events, std::move(callback)});
+        return id;
+    }
+
+    bool EventSources::removeWatch(id_type id)
+    {
+        auto it = std::find_if(m_watches.begin(), m_watches.end(), [id](const Watch& watch) { return watch.id == id; });
+        if (it == m_watches.end())
+            return false;
+
+        m_watches.erase(it);
+        return true;
+    }
+
+    bool EventSources::dispatchWatch(id_type id, uint32_t ready)
+    {
+        auto it = std::find_if(m_watches.begin(), m_watches.end(), [id](const Watch& watch) { return watch.id == id; });
+        if (it == m_watches.end())
+            return false;
+
+        // The callback might remove watchers, call a copy.
+        const int fd{it->fd};
+        watch_callback callback{it->callback};
+        if (ready & Invalid)
+            m_watches.erase(it);
+
+        callback(fd, ready);
+        return true;
+    }
+} // namespace pTK
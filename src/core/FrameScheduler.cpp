@@ -0,0 +1,81 @@
+//
+//  core/FrameScheduler.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// pTK Headers
+#include "ptk/core/FrameScheduler.hpp"
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+
+namespace pTK
+{
+    FrameScheduler::FrameScheduler(double refreshRate) noexcept
+    {
+        setRefreshRate(refreshRate);
+    }
+
+    void FrameScheduler::setRefreshRate(double refreshRate) noexcept
+    {
+        m_refreshRate = (refreshRate > 0.0) ? refreshRate : 60.0;
+        m_interval = duration{static_cast<duration::rep>(std::llround(1e9 / m_refreshRate))};
+    }
+
+    FrameScheduler::duration FrameScheduler::timeUntilFrame(time_point now) const noexcept
+    {
+        return (m_nextDeadline > now) ? (m_nextDeadline - now) : duration{0};
+    }
+
+    void FrameScheduler::beginFrame(time_point now) noexcept
+    {
+        // Idle for more than an interval, align the deadlines to this frame.
+        m_frameDeadline = ((now - m_nextDeadline) >= m_interval) ? now : m_nextDeadline;
+        m_frameStart = now;
+    }
+
+    void FrameScheduler::endFrame(time_point now) noexcept
+    {
+        m_samples[m_sampleIndex] = now - m_frameStart;
+        m_sampleIndex = (m_sampleIndex + 1) % SampleCount;
+        ++m_frames;
+
+        // The frame should be presented before the deadline after its own.
+        m_nextDeadline = m_frameDeadline + m_interval;
+        if (m_nextDeadline < now)
+        {
+            ++m_missed;
+
+            // Skip the deadlines that have passed, keeping the alignment.
+            const auto skipped{((now - m_nextDeadline) / m_interval) + 1};
+            m_nextDeadline += m_interval * skipped;
+        }
+    }
+
+    FrameScheduler::Stats FrameScheduler::stats() const
+    {
+        Stats stats{};
+        stats.frames = m_frames;
+        stats.missed = m_missed;
+
+        const std::size_t count{std::min(m_frames, SampleCount)};
+        if (count == 0)
+            return stats;
+
+        std::array<duration, SampleCount> sorted{m_samples};
+        std::sort(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(count));
+        stats.p50 = sorted[(count - 1) / 2];
+        stats.p99 = sorted[((count - 1) * 99) / 100];
+        return stats;
+    }
+
+    void FrameScheduler::resetStats() noexcept
+    {
+        m_sampleIndex = 0;
+        m_frames = 0;
+        m_missed = 0;
+    }
+} // namespace pTK
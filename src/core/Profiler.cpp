@@ -0,0 +1,249 @@
+//
+//  core/Profiler.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// pTK Headers
+#include "ptk/core/Profiler.hpp"
+
+// C++ Headers
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if __has_include(<cxxabi.h>)
+    #include <cxxabi.h>
+    #define PTK_PROFILE_DEMANGLE
+#endif
+
+namespace pTK
+{
+    // Fields are atomic (and accessed relaxed) since the exporter might read a
+    // zone while it is being overwritten, such zones are discarded.
+    struct ProfileZoneData
+    {
+        std::atomic<const char*> name{nullptr};
+        std::atomic<int64_t> begin{0};
+        std::atomic<int64_t> end{0};
+        std::atomic<bool> mangled{false};
+    };
+
+    // Ring buffer written by a single thread.
+    struct ProfileThreadBuffer
+    {
+        explicit ProfileThreadBuffer(uint64_t threadId)
+            : id{threadId}
+        {}
+
+        const uint64_t id;
+        std::atomic<uint64_t> head{0};    // Number of zones written.
+        std::atomic<uint64_t> writing{0}; // Number of zones started to be written.
+        std::atomic<uint64_t> start{0};   // First zone after a clear.
+        std::array<ProfileZoneData, Profiler::BufferSize> zones{};
+    };
+
+    struct ProfileRegistry
+    {
+        std::mutex mutex{};
+        std::vector<std::unique_ptr<ProfileThreadBuffer>> buffers{};
+    };
+
+    static ProfileRegistry& GetRegistry()
+    {
+        // Never destroyed, threads might record zones during static destruction.
+        static ProfileRegistry* registry{new ProfileRegistry{}};
+        return *registry;
+    }
+
+    static ProfileThreadBuffer* CreateThreadBuffer()
+    {
+        ProfileRegistry& registry{GetRegistry()};
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        registry.buffers.push_back(std::make_unique<ProfileThreadBuffer>(registry.buffers.size() + 1));
+        return registry.buffers.back().get();
+    }
+
+    static ProfileThreadBuffer* GetThreadBuffer()
+    {
+        // The buffer is kept after the thread exits, its zones can still be exported.
+        static thread_local ProfileThreadBuffer* buffer{CreateThreadBuffer()};
+        return buffer;
+    }
+
+    void Profiler::Record(const char* name, int64_t begin, int64_t end, bool mangled) noexcept
+    {
+        ProfileThreadBuffer* buffer{GetThreadBuffer()};
+        const uint64_t index{buffer->head.load(std::memory_order_relaxed)};
+
+        // Announces the overwrite before the zone is written, for the exporter.
+        buffer->writing.store(index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        ProfileZoneData& zone{buffer->zones[index % BufferSize]};
+        zone.name.store(name, std::memory_order_relaxed);
+        zone.begin.store(begin, std::memory_order_relaxed);
+        zone.end.store(end, std::memory_order_relaxed);
+        zone.mangled.store(mangled, std::memory_order_relaxed);
+
+        // Publishes the zone.
+        buffer->head.store(index + 1, std::memory_order_release);
+    }
+
+    int64_t Profiler::Now() noexcept
+    {
+        using namespace std::chrono;
+        return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+    }
+
+    struct ProfileZoneCopy
+    {
+        const char* name;
+        int64_t begin;
+        int64_t end;
+        bool mangled;
+    };
+
+    // Copies the zones of a buffer that are not overwritten while copying.
+    static std::vector<ProfileZoneCopy> CopyZones(const ProfileThreadBuffer& buffer)
+    {
+        const auto first = [&buffer](uint64_t head) {
+            const uint64_t start{buffer.start.load(std::memory_order_relaxed)};
+            const uint64_t oldest{(head > Profiler::BufferSize) ? (head - Profiler::BufferSize) : 0};
+            return (start > oldest) ? start : oldest;
+        };
+
+        const uint64_t head{buffer.head.load(std::memory_order_acquire)};
+        std::vector<ProfileZoneCopy> zones{};
+        zones.reserve(static_cast<std::size_t>(head - first(head)));
+        for (uint64_t i{first(head)}; i < head; ++i)
+        {
+            const ProfileZoneData& zone{buffer.zones[i % Profiler::BufferSize]};
+            zones.push_back({zone.name.load(std::memory_order_relaxed), zone.begin.load(std::memory_order_relaxed),
+                             zone.end.load(std::memory_order_relaxed), zone.mangled.load(std::memory_order_relaxed)});
+        }
+
+        // Zones the writer started to overwrite while copying are dropped.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t writing{buffer.writing.load(std::memory_order_relaxed)};
+        const uint64_t valid{(writing > Profiler::BufferSize) ? (writing - Profiler::BufferSize) : 0};
+        const uint64_t begin{first(head)};
+        if (valid > begin)
+            zones.erase(zones.begin(), zones.begin() + static_cast<std::ptrdiff_t>(std::min(valid, head) - begin));
+
+        return zones;
+    }
+
+    static std::string ZoneName(const ProfileZoneCopy& zone)
+    {
+        if (zone.name == nullptr)
+            return {};
+
+#ifdef PTK_PROFILE_DEMANGLE
+        if (zone.mangled)
+        {
+            int status{-1};
+            char* demangled{abi::__cxa_demangle(zone.name, nullptr, nullptr, &status)};
+            if ((status == 0) && (demangled != nullptr))
+            {
+                std::string name{demangled};
+                std::free(demangled);
+                return name;
+            }
+        }
+#endif
+
+        return zone.name;
+    }
+
+    static void WriteJSONString(std::ostream& stream, const std::string& str)
+    {
+        stream << '"';
+        for (const char c : str)
+        {
+            switch (c)
+            {
+                case '"':
+                    stream << "\\\"";
+                    break;
+                case '\\':
+                    stream << "\\\\";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                        stream << escaped;
+                    }
+                    else
+                        stream << c;
+                    break;
+            }
+        }
+        stream << '"';
+    }
+
+    static void WriteMicroseconds(std::ostream& stream, int64_t ns)
+    {
+        // Chrome trace timestamps are in microseconds.
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%lld.%03lld", static_cast<long long>(ns / 1000),
+                      static_cast<long long>(ns % 1000));
+        stream << buffer;
+    }
+
+    void Profiler::WriteChromeTrace(std::ostream& stream)
+    {
+        ProfileRegistry& registry{GetRegistry()};
+        std::lock_guard<std::mutex> lock{registry.mutex};
+
+        stream << "{\"traceEvents\":[";
+        bool first{true};
+        for (const std::unique_ptr<ProfileThreadBuffer>& buffer : registry.buffers)
+        {
+            stream << (first ? "\n" : ",\n");
+            first = false;
+            stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->id
+                   << ",\"args\":{\"name\":\"Thread " << buffer->id << "\"}}";
+
+            for (const ProfileZoneCopy& zone : CopyZones(*buffer))
+            {
+                stream << ",\n{\"name\":";
+                WriteJSONString(stream, ZoneName(zone));
+                stream << ",\"cat\":\"ptk\",\"ph\":\"X\",\"ts\":";
+                WriteMicroseconds(stream, zone.begin);
+                stream << ",\"dur\":";
+                WriteMicroseconds(stream, zone.end - zone.begin);
+                stream << ",\"pid\":1,\"tid\":" << buffer->id << "}";
+            }
+        }
+        stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    bool Profiler::WriteChromeTrace(const std::string& path)
+    {
+        std::ofstream file{path};
+        if (!file)
+            return false;
+
+        WriteChromeTrace(file);
+        return static_cast<bool>(file);
+    }
+
+    void Profiler::Clear() noexcept
+    {
+        ProfileRegistry& registry{GetRegistry()};
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        for (const std::unique_ptr<ProfileThreadBuffer>& buffer : registry.buffers)
+            buffer->start.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+} // namespace pTK
@@ -0,0 +1,78 @@
+//
+//  core/ShapedText.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// pTK Headers
+#include "ptk/core/ShapedText.hpp"
+
+// Skia Headers
+PTK_DISABLE_WARN_BEGIN()
+#include "include/core/SkFontMetrics.h"
+PTK_DISABLE_WARN_END()
+
+// C++ Headers
+#include <cmath>
+#include <cstdint>
+
+namespace pTK
+{
+    static std::size_t CharByteSize(SkTextEncoding encoding)
+    {
+        if (encoding == SkTextEncoding::kUTF16)
+            return 2;
+        if (encoding == SkTextEncoding::kUTF32)
+            return 4;
+
+        return 1;
+    }
+
+    // Number of bytes of leading spaces.
+    static std::size_t LeadingSpaceBytes(const void* text, std::size_t byteLength, SkTextEncoding encoding)
+    {
+        // This function only handles " " for now.
+        // TODO: Support for no-break space should be added.
+
+        const std::size_t charSize{CharByteSize(encoding)};
+        const std::size_t count{byteLength / charSize};
+
+        std::size_t i{0};
+        for (; i < count; ++i)
+        {
+            uint32_t ch{0};
+
+            if (encoding == SkTextEncoding::kUTF16)
+                ch = static_cast<const uint16_t*>(text)[i];
+            else if (encoding == SkTextEncoding::kUTF32)
+                ch = static_cast<const uint32_t*>(text)[i];
+            else
+                ch = static_cast<const uint8_t*>(text)[i];
+
+            if (ch != 0x20)
+                break;
+        }
+
+        return i * charSize;
+    }
+
+    ShapedText::ShapedText(const void* text, std::size_t byteLength, SkTextEncoding encoding, const SkFont& font)
+    {
+        if ((text == nullptr) || (byteLength == 0))
+            return;
+
+        SkRect bounds{};
+        m_advance = font.measureText(text, byteLength, encoding, &bounds);
+        m_bounds = {bounds.width(), bounds.height()};
+        m_blob = SkTextBlob::MakeFromText(text, byteLength, font, encoding);
+
+        float spaceOffset{0.0f};
+        if (const std::size_t spaceBytes{LeadingSpaceBytes(text, byteLength, encoding)}; spaceBytes > 0)
+            spaceOffset = font.measureText(text, spaceBytes, encoding);
+
+        SkFontMetrics metrics{};
+        font.getMetrics(&metrics);
+        m_offset = {spaceOffset - bounds.x(), std::abs(metrics.fCapHeight)};
+    }
+} // namespace pTK
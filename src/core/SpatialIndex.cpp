@@ -0,0 +1,185 @@
+//
+//  core/SpatialIndex.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// pTK Headers
+#include "ptk/core/SpatialIndex.hpp"
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+
+namespace pTK
+{
+    static int64_t AxisStart(const Rect& rect, bool horizontal) noexcept
+    {
+        return (horizontal) ? rect.pos.x : rect.pos.y;
+    }
+
+    static int64_t AxisEnd(const Rect& rect, bool horizontal) noexcept
+    {
+        return (horizontal) ? rect.right() : rect.bottom();
+    }
+
+    void SpatialIndex::setType(Type type) noexcept
+    {
+        if (m_type != type)
+        {
+            m_type = type;
+            m_valid = false;
+        }
+    }
+
+    void SpatialIndex::build(const std::vector<Rect>& rects)
+    {
+        m_entries.clear();
+        m_maxEnd.clear();
+        m_cells.clear();
+        m_bounds = {};
+        m_columns = 0;
+        m_rows = 0;
+
+        if (m_type == Type::Horizontal || m_type == Type::Vertical)
+            buildAxis(rects);
+        else if (m_type == Type::Grid)
+            buildGrid(rects);
+
+        m_valid = true;
+    }
+
+    SpatialIndex::size_type SpatialIndex::find(const Point& pos) const
+    {
+        if (m_type == Type::Horizontal || m_type == Type::Vertical)
+            return findOnAxis(pos);
+        else if (m_type == Type::Grid)
+            return findInGrid(pos);
+
+        return npos;
+    }
+
+    void SpatialIndex::buildAxis(const std::vector<Rect>& rects)
+    {
+        const bool horizontal{m_type == Type::Horizontal};
+
+        m_entries.reserve(rects.size());
+        for (size_type i{0}; i < rects.size(); ++i)
+            if (!rects[i].isEmpty())
+                m_entries.push_back({rects[i], i});
+
+        // Layouts usually add children in order, avoid sorting when possible.
+        const auto cmp = [horizontal](const Entry& lhs, const Entry& rhs) {
+            return AxisStart(lhs.rect, horizontal) < AxisStart(rhs.rect, horizontal);
+        };
+        if (!std::is_sorted(m_entries.cbegin(), m_entries.cend(), cmp))
+            std::stable_sort(m_entries.begin(), m_entries.end(), cmp);
+
+        m_maxEnd.reserve(m_entries.size());
+        int64_t maxEnd{std::numeric_limits<int64_t>::min()};
+        for (const Entry& entry : m_entries)
+        {
+            maxEnd = std::max(maxEnd, AxisEnd(entry.rect, horizontal));
+            m_maxEnd.push_back(maxEnd);
+        }
+    }
+
+    SpatialIndex::size_type SpatialIndex::findOnAxis(const Point& pos) const
+    {
+        const bool horizontal{m_type == Type::Horizontal};
+        const int64_t value{(horizontal) ? pos.x : pos.y};
+
+        // First entry that starts after pos, every entry before it starts at or before pos.
+        auto it = std::upper_bound(m_entries.cbegin(), m_entries.cend(), value,
+                                   [horizontal](int64_t lhs, const Entry& rhs) {
+                                       return lhs < AxisStart(rhs.rect, horizontal);
+                                   });
+
+        size_type found{npos};
+        for (auto i{static_cast<size_type>(it - m_entries.cbegin())}; i > 0; --i)
+        {
+            // No entry in [0, i - 1] reaches pos.
+            if (m_maxEnd[i - 1] <= value)
+                break;
+
+            const Entry& entry{m_entries[i - 1]};
+            if (entry.index < found && entry.rect.contains(pos))
+                found = entry.index;
+        }
+
+        return found;
+    }
+
+    void SpatialIndex::buildGrid(const std::vector<Rect>& rects)
+    {
+        size_type count{0};
+        for (const Rect& rect : rects)
+        {
+            if (!rect.isEmpty())
+            {
+                m_bounds = m_bounds.united(rect);
+                ++count;
+            }
+        }
+
+        if (count == 0)
+            return;
+
+        // Roughly one rectangle per cell.
+        const auto side{static_cast<size_type>(std::ceil(std::sqrt(static_cast<double>(count))))};
+        m_columns = std::max<size_type>(side, 1);
+        m_rows = m_columns;
+        m_cellSize.width = std::max<Size::value_type>(
+            static_cast<Size::value_type>((m_bounds.size.width + m_columns - 1) / m_columns), 1);
+        m_cellSize.height = std::max<Size::value_type>(
+            static_cast<Size::value_type>((m_bounds.size.height + m_rows - 1) / m_rows), 1);
+
+        const auto cellOf = [this](int64_t value, int64_t start, Size::value_type cellSize, size_type cells) {
+            const int64_t cell{(value - start) / static_cast<int64_t>(cellSize)};
+            return static_cast<size_type>(std::clamp<int64_t>(cell, 0, static_cast<int64_t>(cells) - 1));
+        };
+
+        // Counting sort into cells, entries in a cell are kept in index order.
+        const auto forEachCell = [&](const Rect& rect, auto func) {
+            const size_type x0{cellOf(rect.pos.x, m_bounds.pos.x, m_cellSize.width, m_columns)};
+            const size_type x1{cellOf(static_cast<int64_t>(rect.right()) - 1, m_bounds.pos.x, m_cellSize.width, m_columns)};
+            const size_type y0{cellOf(rect.pos.y, m_bounds.pos.y, m_cellSize.height, m_rows)};
+            const size_type y1{cellOf(static_cast<int64_t>(rect.bottom()) - 1, m_bounds.pos.y, m_cellSize.height, m_rows)};
+            for (size_type y{y0}; y <= y1; ++y)
+                for (size_type x{x0}; x <= x1; ++x)
+                    func((y * m_columns) + x);
+        };
+
+        m_cells.assign((m_columns * m_rows) + 1, 0);
+        for (const Rect& rect : rects)
+            if (!rect.isEmpty())
+                forEachCell(rect, [this](size_type cell) { ++m_cells[cell + 1]; });
+
+        for (size_type i{1}; i < m_cells.size(); ++i)
+            m_cells[i] += m_cells[i - 1];
+
+        std::vector<size_type> next(m_cells.cbegin(), m_cells.cend() - 1);
+        m_entries.resize(m_cells.back());
+        for (size_type i{0}; i < rects.size(); ++i)
+            if (!rects[i].isEmpty())
+                forEachCell(rects[i], [&](size_type cell) { m_entries[next[cell]++] = {rects[i], i}; });
+    }
+
+    SpatialIndex::size_type SpatialIndex::findInGrid(const Point& pos) const
+    {
+        if (!m_bounds.contains(pos))
+            return npos;
+
+        const auto x{static_cast<size_type>((static_cast<int64_t>(pos.x) - m_bounds.pos.x) / m_cellSize.width)};
+        const auto y{static_cast<size_type>((static_cast<int64_t>(pos.y) - m_bounds.pos.y) / m_cellSize.height)};
+        const size_type cell{(std::min(y, m_rows - 1) * m_columns) + std::min(x, m_columns - 1)};
+
+        // Entries are in index order, first match has the lowest index.
+        for (size_type i{m_cells[cell]}; i < m_cells[cell + 1]; ++i)
+            if (m_entries[i].rect.contains(pos))
+                return m_entries[i].index;
+
+        return npos;
+    }
+} // namespace pTK
@@ -11,6 +11,8 @@
 // pTK Headers
 #include "ptk/core/ContextBase.hpp"
 #include "ptk/core/Text.hpp"
+#include "ptk/core/TypefaceCache.hpp"
+#include "ptk/util/UTF.hpp"
 
 // Skia Headers
 PTK_DISABLE_WARN_BEGIN()
@@ -18,6 +20,9 @@ PTK_DISABLE_WARN_BEGIN()
 #include "include/core/SkFontMetrics.h"
 PTK_DISABLE_WARN_END()
 
+// C++ Headers
+#include <algorithm>
+
 namespace pTK
 {
     Text::Text()
@@ -31,51 +36,41 @@ namespace pTK
 
     bool Text::setFontFromFile(const std::string& path)
     {
-        if (!path.empty())
-        {
-            sk_sp<SkTypeface> tf{SkTypeface::MakeFromFile(path.c_str())};
-            if (tf)
-            {
-                m_font.setTypeface(tf);
-                PTK_INFO("Loaded font family \"{0}\" from file \"{1}\"", getFontFamily(), path);
-                updateFontInfo();
-                onTextUpdate();
-                return true;
-            }
-            else
-            {
-                m_font.setTypeface(SkTypeface::MakeDefault());
-                PTK_WARN("Failed to load \"{0}\", fell back to \"{1}\"", path, getFontFamily());
-            }
-        }
+        if (path.empty())
+            return false;
+
+        sk_sp<SkTypeface> tf{TypefaceCache::FromFile(path)};
+        const bool loaded{static_cast<bool>(tf)};
+        m_font.setTypeface((loaded) ? tf : TypefaceCache::FromName(""));
+#ifdef PTK_ENABLE_LOG
+        if (loaded)
+            PTK_INFO("Loaded font family \"{0}\" from file \"{1}\"", getFontFamily(), path);
+        else
+            PTK_WARN("Failed to load \"{0}\", fell back to \"{1}\"", path, getFontFamily());
+#endif
 
-        return false;
+        // The fallback typeface changes the metrics and shaping as well.
+        updateFontInfo();
+        onTextUpdate();
+        return loaded;
     }
 
     bool Text::setFontFamily(const std::string& fontFamily)
     {
+        m_font.setTypeface(TypefaceCache::FromName(fontFamily));
+        const bool loaded{!fontFamily.empty() && (fontFamily == getFontFamily())};
+#ifdef PTK_ENABLE_LOG
         if (fontFamily.empty())
-        {
-            m_font.setTypeface(SkTypeface::MakeDefault());
             PTK_INFO("Loaded default font \"{0}\"", getFontFamily());
-        }
+        else if (loaded)
+            PTK_INFO("Loaded \"{0}\" successfully.", getFontFamily());
         else
-        {
-            m_font.setTypeface(SkTypeface::MakeFromName(fontFamily.c_str(), SkFontStyle::Normal()));
-            if (fontFamily == getFontFamily())
-            {
-                PTK_INFO("Loaded \"{0}\" successfully.", getFontFamily());
-                updateFontInfo();
-                onTextUpdate();
-                return true;
-            }
-#ifdef PTK_DEBUG
-            else
-                PTK_WARN("Failed to load \"{0}\", fell back to \"{1}\"", fontFamily, getFontFamily());
+            PTK_WARN("Failed to load \"{0}\", fell back to \"{1}\"", fontFamily, getFontFamily());
 #endif
-        }
 
-        return false;
+        updateFontInfo();
+        onTextUpdate();
+        return loaded;
     }
 
     std::string Text::getFontFamily() const
@@ -116,6 +111,57 @@ namespace pTK
         return {bounds.width(), bounds.height()};
     }
 
+    ShapedText Text::shapeStr(const std::string& str) const
+    {
+        return ShapedText{str.c_str(), str.size(), SkTextEncoding::kUTF8, m_font};
+    }
+
+    const ShapedText& Text::shapedText() const
+    {
+        return m_shapedText;
+    }
+
+    void Text::updateShapedText(const std::string& str)
+    {
+        m_shapedText = shapeStr(str);
+    }
+
+    float Text::MeasureAdvances(const SkFont& font, const char* text, std::size_t size, float* advances)
+    {
+        // Measured in chunks of code points to not allocate.
+        constexpr std::size_t chunk{64};
+        SkUnichar codepoints[chunk];
+        std::size_t starts[chunk];
+        SkGlyphID glyphs[chunk];
+        SkScalar widths[chunk];
+
+        float total{0.0f};
+        std::size_t pos{0};
+        while (pos < size)
+        {
+            std::size_t count{0};
+            for (; (count < chunk) && (pos < size); ++count)
+            {
+                uint32_t cp{0};
+                starts[count] = pos;
+                pos += UTF::DecodeUTF8(text + pos, size - pos, &cp, 1).read;
+                codepoints[count] = static_cast<SkUnichar>(cp);
+            }
+
+            font.unicharsToGlyphs(codepoints, static_cast<int>(count), glyphs);
+            font.getWidths(glyphs, static_cast<int>(count), widths);
+            for (std::size_t i{0}; i < count; ++i)
+            {
+                const std::size_t end{(i + 1 < count) ? starts[i + 1] : pos};
+                advances[starts[i]] = widths[i];
+                std::fill(advances + starts[i] + 1, advances + end, 0.0f);
+                total += widths[i];
+            }
+        }
+
+        return total;
+    }
+
     const SkFont& Text::skFont() const
     {
         return m_font;
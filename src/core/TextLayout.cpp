@@ -0,0 +1,277 @@
+//
+//  core/TextLayout.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// pTK Headers
+#include "ptk/core/Text.hpp"
+#include "ptk/core/TextLayout.hpp"
+#include "ptk/util/UTF.hpp"
+
+// Skia Headers
+PTK_DISABLE_WARN_BEGIN()
+#include "include/core/SkFontMetrics.h"
+PTK_DISABLE_WARN_END()
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+
+namespace pTK
+{
+    static constexpr float s_infinity{std::numeric_limits<float>::infinity()};
+
+    static bool IsSpace(char c)
+    {
+        return (c == ' ') || (c == '\t');
+    }
+
+    void TextLayout::setText(std::string text)
+    {
+        m_text = std::move(text);
+        layout();
+    }
+
+    void TextLayout::setFont(const SkFont& font)
+    {
+        m_font = font;
+
+        SkFontMetrics metrics{};
+        m_font.getMetrics(&metrics);
+        m_ascent = -metrics.fAscent;
+        m_lineHeight = metrics.fDescent - metrics.fAscent + metrics.fLeading;
+
+        layout();
+    }
+
+    void TextLayout::setWidth(float width)
+    {
+        if (!(width > 0.0f))
+            width = s_infinity;
+        if (width == m_width)
+            return;
+
+        m_width = width;
+        m_brokenLines = 0;
+
+        for (Paragraph& paragraph : m_paragraphs)
+        {
+            if (paragraph.lines.empty())
+            {
+                // Single line, still fits.
+                if (paragraph.naturalWidth <= m_width)
+                    continue;
+
+                breakLines(paragraph, 0);
+                continue;
+            }
+
+            // First line that changes, the lines before keep their breaks.
+            const auto it = std::find_if(paragraph.lines.cbegin(), paragraph.lines.cend(), [this](const BrokenLine& l) {
+                return !((l.width <= m_width) && (m_width < l.fit));
+            });
+            if (it != paragraph.lines.cend())
+                breakLines(paragraph, static_cast<std::size_t>(it - paragraph.lines.cbegin()));
+        }
+
+        updateLines();
+    }
+
+    TextLayout::Line TextLayout::line(std::size_t index) const
+    {
+        // Paragraph that contains the line.
+        const auto it = std::upper_bound(m_firstLine.cbegin(), m_firstLine.cend(), index);
+        const auto p = static_cast<std::size_t>(it - m_firstLine.cbegin()) - 1;
+        const Paragraph& paragraph{m_paragraphs[p]};
+
+        if (paragraph.lines.empty())
+            return {paragraph.start, paragraph.end, paragraph.naturalWidth};
+
+        const BrokenLine& l{paragraph.lines[index - m_firstLine[p]]};
+        return {paragraph.start + l.start, paragraph.start + l.end, l.width};
+    }
+
+    std::pair<std::size_t, std::size_t> TextLayout::linesBetween(float top, float bottom) const
+    {
+        if (!(m_lineHeight > 0.0f) || (bottom <= top))
+            return {0, 0};
+
+        const auto count{static_cast<float>(lineCount())};
+        const float first{std::clamp(std::floor(top / m_lineHeight), 0.0f, count)};
+        const float last{std::clamp(std::ceil(bottom / m_lineHeight), first, count)};
+        return {static_cast<std::size_t>(first), static_cast<std::size_t>(last)};
+    }
+
+    void TextLayout::layout()
+    {
+        m_paragraphs.clear();
+        m_brokenLines = 0;
+
+        std::size_t start{0};
+        while (start <= m_text.size())
+        {
+            std::size_t end{m_text.find('\n', start)};
+            if (end == std::string::npos)
+                end = m_text.size();
+
+            // "\r\n" line endings.
+            const std::size_t textEnd{((end > start) && (m_text[end - 1] == '\r')) ? (end - 1) : end};
+
+            Paragraph paragraph{start, textEnd, 0.0f, 0.0f, {}, {}};
+            paragraph.naturalWidth =
+                m_font.measureText(m_text.data() + start, textEnd - start, SkTextEncoding::kUTF8);
+            paragraph.maxLineWidth = paragraph.naturalWidth;
+            if (paragraph.naturalWidth > m_width)
+                breakLines(paragraph, 0);
+
+            m_paragraphs.push_back(std::move(paragraph));
+            start = end + 1;
+        }
+
+        updateLines();
+    }
+
+    void TextLayout::measureSegments(Paragraph& paragraph)
+    {
+        const char* text{m_text.data() + paragraph.start};
+        const std::size_t size{paragraph.end - paragraph.start};
+        m_advances.resize(size);
+        Text::MeasureAdvances(m_font, text, size, m_advances.data());
+
+        paragraph.segments.clear();
+        Segment segment{0, 0, 0.0f, 0.0f};
+        bool inSpaces{false};
+        for (std::size_t i{0}; i < size; ++i)
+        {
+            const bool space{IsSpace(text[i])};
+            if (space && !inSpaces)
+            {
+                segment.wordEnd = static_cast<uint32_t>(i);
+                inSpaces = true;
+            }
+            else if (!space && inSpaces)
+            {
+                segment.end = static_cast<uint32_t>(i);
+                paragraph.segments.push_back(segment);
+                segment = {0, 0, 0.0f, 0.0f};
+                inSpaces = false;
+            }
+
+            if (space)
+                segment.spaceAdvance += m_advances[i];
+            else
+                segment.advance += m_advances[i];
+        }
+
+        if (!inSpaces)
+            segment.wordEnd = static_cast<uint32_t>(size);
+        segment.end = static_cast<uint32_t>(size);
+        paragraph.segments.push_back(segment);
+    }
+
+    void TextLayout::breakLines(Paragraph& paragraph, std::size_t first)
+    {
+        if (paragraph.naturalWidth <= m_width)
+        {
+            paragraph.lines.clear();
+            paragraph.segments.clear();
+            paragraph.maxLineWidth = paragraph.naturalWidth;
+            return;
+        }
+
+        if (paragraph.segments.empty())
+            measureSegments(paragraph);
+
+        const char* text{m_text.data() + paragraph.start};
+        const std::vector<Segment>& segments{paragraph.segments};
+
+        // Resumes at the start of the first changed line.
+        std::size_t seg{0};
+        uint32_t pos{0};
+        if (first < paragraph.lines.size())
+        {
+            seg = paragraph.lines[first].segment;
+            pos = paragraph.lines[first].start;
+        }
+        paragraph.lines.resize(std::min(first, paragraph.lines.size()));
+
+        BrokenLine line{pos, pos, static_cast<uint32_t>(seg), 0.0f, s_infinity};
+        bool empty{true};
+        float spaceAdvance{0.0f};
+        while (seg < segments.size())
+        {
+            const Segment& segment{segments[seg]};
+            const uint32_t segmentStart{(seg == 0) ? 0 : segments[seg - 1].end};
+
+            // The line might start inside a word that was broken.
+            const float advance{(pos == segmentStart) ? segment.advance
+                                                      : m_font.measureText(text + pos, segment.wordEnd - pos,
+                                                                           SkTextEncoding::kUTF8)};
+
+            if (!empty)
+            {
+                if (line.width + spaceAdvance + advance > m_width)
+                {
+                    line.fit = line.width + spaceAdvance + advance;
+                    paragraph.lines.push_back(line);
+                    line = {pos, pos, static_cast<uint32_t>(seg), 0.0f, s_infinity};
+                    empty = true;
+                    continue;
+                }
+
+                line.width += spaceAdvance + advance;
+            }
+            else if (advance > m_width)
+            {
+                // Word wider than the line, broken between chars (at least one per line).
+                m_advances.resize(segment.wordEnd - pos);
+                Text::MeasureAdvances(m_font, text + pos, segment.wordEnd - pos, m_advances.data());
+                float width{0.0f};
+                for (uint32_t i{pos}; i < segment.wordEnd; ++i)
+                {
+                    const float charAdvance{m_advances[i - pos]};
+                    if (UTF::IsCharStart(text[i]) && (width > 0.0f) && (width + charAdvance > m_width))
+                    {
+                        paragraph.lines.push_back({line.start, i, static_cast<uint32_t>(seg), width,
+                                                   width + charAdvance});
+                        line.start = i;
+                        width = 0.0f;
+                    }
+                    width += charAdvance;
+                }
+
+                line.width = width;
+            }
+            else
+                line.width = advance;
+
+            line.end = segment.wordEnd;
+            empty = false;
+            spaceAdvance = segment.spaceAdvance;
+            pos = segment.end;
+            ++seg;
+        }
+        paragraph.lines.push_back(line);
+
+        m_brokenLines += paragraph.lines.size() - first;
+        paragraph.maxLineWidth = 0.0f;
+        for (const BrokenLine& l : paragraph.lines)
+            paragraph.maxLineWidth = std::max(paragraph.maxLineWidth, l.width);
+    }
+
+    void TextLayout::updateLines()
+    {
+        m_firstLine.resize(m_paragraphs.size() + 1);
+        m_firstLine[0] = 0;
+        m_maxLineWidth = 0.0f;
+        for (std::size_t i{0}; i < m_paragraphs.size(); ++i)
+        {
+            const Paragraph& paragraph{m_paragraphs[i]};
+            const std::size_t lines{paragraph.lines.empty() ? 1 : paragraph.lines.size()};
+            m_firstLine[i + 1] = m_firstLine[i] + lines;
+            m_maxLineWidth = std::max(m_maxLineWidth, paragraph.maxLineWidth);
+        }
+    }
+} // namespace pTK
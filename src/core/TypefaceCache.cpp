@@ -0,0 +1,123 @@
+//
+//  core/TypefaceCache.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// pTK Headers
+#include "ptk/core/TypefaceCache.hpp"
+
+// Skia Headers
+PTK_DISABLE_WARN_BEGIN()
+#include "include/core/SkGraphics.h"
+PTK_DISABLE_WARN_END()
+
+// C++ Headers
+#include <mutex>
+#include <unordered_map>
+
+namespace pTK
+{
+    struct TypefaceCacheData
+    {
+        std::mutex mutex{};
+        std::unordered_map<std::string, sk_sp<SkTypeface>> typefaces{};
+        uint64_t hits{0};
+        uint64_t misses{0};
+    };
+
+    static TypefaceCacheData& GetCacheData()
+    {
+        static TypefaceCacheData data{};
+        return data;
+    }
+
+    // Families and files use separate key prefixes, a path could be a family name.
+    static std::string NameKey(const std::string& family, const SkFontStyle& style)
+    {
+        return "n:" + std::to_string(style.weight()) + ":" + std::to_string(style.width()) + ":" +
+               std::to_string(static_cast<int>(style.slant())) + ":" + family;
+    }
+
+    static std::string FileKey(const std::string& path)
+    {
+        return "f:" + path;
+    }
+
+    template <typename Loader>
+    static sk_sp<SkTypeface> Lookup(const std::string& key, Loader&& loader, bool cacheNull)
+    {
+        TypefaceCacheData& data{GetCacheData()};
+
+        // The lock is held while loading, concurrent lookups of the same typeface load it once.
+        std::lock_guard<std::mutex> lock{data.mutex};
+        if (auto it = data.typefaces.find(key); it != data.typefaces.end())
+        {
+            ++data.hits;
+            return it->second;
+        }
+
+        ++data.misses;
+        sk_sp<SkTypeface> typeface{loader()};
+        if (typeface || cacheNull)
+            data.typefaces.emplace(key, typeface);
+
+        return typeface;
+    }
+
+    sk_sp<SkTypeface> TypefaceCache::FromName(const std::string& family, SkFontStyle style)
+    {
+        return Lookup(
+            NameKey(family, style),
+            [&family, &style]() {
+                if (family.empty())
+                    return SkTypeface::MakeDefault();
+                return SkTypeface::MakeFromName(family.c_str(), style);
+            },
+            true);
+    }
+
+    sk_sp<SkTypeface> TypefaceCache::FromFile(const std::string& path)
+    {
+        return Lookup(
+            FileKey(path), [&path]() { return SkTypeface::MakeFromFile(path.c_str()); }, false);
+    }
+
+    void TypefaceCache::Preload(const std::vector<std::string>& families)
+    {
+        for (const std::string& family : families)
+            static_cast<void>(FromName(family));
+    }
+
+    void TypefaceCache::SetGlyphCacheLimit(std::size_t bytes)
+    {
+        SkGraphics::SetFontCacheLimit(bytes);
+    }
+
+    TypefaceCache::Stats TypefaceCache::GetStats()
+    {
+        Stats stats{};
+        {
+            TypefaceCacheData& data{GetCacheData()};
+            std::lock_guard<std::mutex> lock{data.mutex};
+            stats.typefaces = data.typefaces.size();
+            stats.hits = data.hits;
+            stats.misses = data.misses;
+        }
+
+        stats.glyphCacheUsed = SkGraphics::GetFontCacheUsed();
+        stats.glyphCacheLimit = SkGraphics::GetFontCacheLimit();
+        stats.glyphCacheCount = SkGraphics::GetFontCacheCountUsed();
+        return stats;
+    }
+
+    void TypefaceCache::Clear()
+    {
+        TypefaceCacheData& data{GetCacheData()};
+        std::lock_guard<std::mutex> lock{data.mutex};
+        data.typefaces.clear();
+        data.hits = 0;
+        data.misses = 0;
+    }
+} // namespace pTK
@@ -6,9 +6,13 @@
 //
 
 // pTK Headers
+#include "ptk/core/Profiler.hpp"
 #include "ptk/core/Widget.hpp"
 #include "ptk/util/Math.hpp"
 
+// C++ Headers
+#include <typeinfo>
+
 namespace pTK
 {
     Widget::Widget()
@@ -71,6 +75,8 @@ namespace pTK
 
     bool Widget::update()
     {
+        reportDamage();
+
         if (m_parent != nullptr)
             return m_parent->updateChild(this);
 
@@ -83,6 +89,12 @@ namespace pTK
     }
 
     bool Widget::draw()
+    {
+        reportDamage();
+        return propagateDraw();
+    }
+
+    bool Widget::propagateDraw()
     {
         if (m_parent != nullptr)
             return m_parent->drawChild(this);
@@ -90,6 +102,60 @@ namespace pTK
         return false;
     }
 
+    void Widget::addDamage(const Rect& rect)
+    {
+        // Damage from the Widget or any child makes the cached drawing outdated.
+        if (m_cache)
+            m_cache->invalidate();
+
+        if (m_parent != nullptr)
+            m_parent->addDamage(rect);
+    }
+
+    void Widget::reportDamage()
+    {
+        const Rect bounds{getBounds()};
+        if (bounds != m_lastBounds)
+            addDamage(m_lastBounds);
+
+        addDamage(bounds);
+        m_lastBounds = bounds;
+    }
+
+    void Widget::drawCached(Canvas* canvas)
+    {
+        // Named after the widget class.
+        PTK_PROFILE_ZONE_TYPE(typeid(*this));
+
+        if (m_cache)
+            m_cache->draw(canvas, getBounds(), *this);
+        else
+            onDraw(canvas);
+    }
+
+    void Widget::setCachePolicy(CachePolicy policy)
+    {
+        if (policy == getCachePolicy())
+            return;
+
+        if (policy == CachePolicy::None)
+            m_cache.reset();
+        else
+            m_cache = std::make_unique<DrawCache>(policy);
+
+        draw();
+    }
+
+    CachePolicy Widget::getCachePolicy() const noexcept
+    {
+        return (m_cache) ? m_cache->policy() : CachePolicy::None;
+    }
+
+    DrawCache::Stats Widget::getCacheStats() const noexcept
+    {
+        return (m_cache) ? m_cache->stats() : DrawCache::Stats{};
+    }
+
     void Widget::show()
     {
         Drawable::show(); // Set the visible boolean.
@@ -20,6 +20,9 @@ PTK_DISABLE_WARN_END()
 
 namespace pTK
 {
+    // Below this amount of children a linear search is faster than using the index.
+    static constexpr WidgetContainer::size_type s_minIndexedChildren{32};
+
     WidgetContainer::WidgetContainer()
         : Widget()
     {
@@ -35,12 +38,23 @@ namespace pTK
 
     void WidgetContainer::add(const value_type& widget)
     {
-        auto it = std::find(m_holder.cbegin(), m_holder.cend(), widget);
-
-        if (it == m_holder.cend())
+        if (findEntry(widget.get()) == nullptr)
         {
+            // The index of the widget is only kept for one container.
+            if (auto* parent = dynamic_cast<WidgetContainer*>(widget->getParent()))
+                parent->remove(widget);
+
+            widget->m_parentIndex = m_holder.size();
             m_holder.push_back(widget);
+            m_index.invalidate();
             widget->setParent(this);
+
+            if (batching())
+            {
+                m_batchChanged = true;
+                return;
+            }
+
             onAdd(widget);
             draw();
         }
@@ -48,18 +62,43 @@ namespace pTK
 
     void WidgetContainer::remove(const value_type& widget)
     {
-        auto it = std::find(m_holder.cbegin(), m_holder.cend(), widget);
-
-        if (it != m_holder.cend())
+        if (findEntry(widget.get()) != nullptr)
         {
+            const size_type index{widget->m_parentIndex};
             widget->setParent(nullptr);
-            if (m_currentHoverWidget.ptr == widget.get())
-                m_currentHoverWidget = {};
-            if (m_lastClickedWidget.ptr == widget.get())
-                m_lastClickedWidget = {};
+            if (m_currentHoverWidget == widget.get())
+                m_currentHoverWidget = nullptr;
+            if (m_lastClickedWidget == widget.get())
+                m_lastClickedWidget = nullptr;
+
+            if (!batching())
+                onRemove(widget);
+
+            m_holder.erase(m_holder.cbegin() + static_cast<container_type::difference_type>(index));
+            reindex(index);
+            m_index.invalidate();
+
+            if (batching())
+                m_batchChanged = true;
+            else
+                draw();
+        }
+    }
 
-            onRemove(widget);
-            m_holder.erase(it);
+    void WidgetContainer::beginBatch() noexcept
+    {
+        ++m_batchDepth;
+    }
+
+    void WidgetContainer::endBatch()
+    {
+        if ((m_batchDepth == 0) || (--m_batchDepth > 0))
+            return;
+
+        if (m_batchChanged)
+        {
+            m_batchChanged = false;
+            onBatchEnd();
             draw();
         }
     }
@@ -72,13 +111,41 @@ namespace pTK
             item->setParent(nullptr);
 
         m_holder.clear();
+        m_index.invalidate();
+
+        m_lastClickedWidget = nullptr;
+        m_currentHoverWidget = nullptr;
+    }
+
+    const WidgetContainer::value_type* WidgetContainer::findEntry(const Widget* widget) const noexcept
+    {
+        // The index is only valid if the widget is still a child of this container.
+        if ((widget != nullptr) && (widget->getParent() == this))
+        {
+            const size_type index{widget->m_parentIndex};
+            if ((index < m_holder.size()) && (m_holder[index].get() == widget))
+                return &m_holder[index];
+        }
 
-        m_lastClickedWidget = {};
-        m_currentHoverWidget = {};
+        return nullptr;
+    }
+
+    void WidgetContainer::reindex(size_type first) noexcept
+    {
+        for (size_type i{first}; i < m_holder.size(); ++i)
+            m_holder[i]->m_parentIndex = i;
+    }
+
+    void WidgetContainer::setSpatialIndexType(SpatialIndex::Type type)
+    {
+        m_index.setType(type);
     }
 
     WidgetContainer::const_iterator WidgetContainer::findChildAtPos(const Point& pos) const
     {
+        if ((m_index.type() != SpatialIndex::Type::None) && (m_holder.size() >= s_minIndexedChildren))
+            return findIndexedChildAtPos(pos);
+
         for (auto it = cbegin(); it != m_holder.cend(); ++it)
         {
             const auto& item = *it;
@@ -96,6 +163,30 @@ namespace pTK
         return cend();
     }
 
+    WidgetContainer::const_iterator WidgetContainer::findIndexedChildAtPos(const Point& pos) const
+    {
+        if (!m_index.valid())
+        {
+            std::vector<Rect> rects{};
+            rects.reserve(m_holder.size());
+            for (const auto& item : m_holder)
+            {
+                // Edges are inclusive in findChildAtPos, Rect is not.
+                const Size wSize{item->getSize()};
+                rects.push_back({item->getPosition(),
+                                 {Math::AddWithoutOverflow(wSize.width, Size::value_type{1}),
+                                  Math::AddWithoutOverflow(wSize.height, Size::value_type{1})}});
+            }
+            m_index.build(rects);
+        }
+
+        const SpatialIndex::size_type index{m_index.find(pos)};
+        if (index == SpatialIndex::npos)
+            return cend();
+
+        return cbegin() + static_cast<container_type::difference_type>(index);
+    }
+
     template <typename Func>
     static void DelayDeleteZone(const WidgetContainer::value_type& widget, Func func)
     {
@@ -115,6 +206,7 @@ namespace pTK
             wPos += deltaPos;
             item->setPosHint(wPos);
         }
+        m_index.invalidate();
 
         Widget::setPosHint(pos);
     }
@@ -127,23 +219,40 @@ namespace pTK
 
     bool WidgetContainer::updateChild(Widget* widget)
     {
+        // Position or size of the child might have changed.
+        m_index.invalidate();
+
         if (!m_busy)
         {
             m_busy = true;
 
-            auto it = std::find_if(m_holder.cbegin(), m_holder.cend(), [&widget](const auto& entry) {
-                return entry.get() == widget;
-            });
-
-            if (it != m_holder.cend())
+            if (findEntry(widget) != nullptr)
             {
-                onChildUpdate(static_cast<size_type>(it - m_holder.cbegin()));
-                draw();
+                if (batching())
+                {
+                    // Handled when the batch update ends.
+                    m_batchChanged = true;
+                    m_busy = false;
+                    return true;
+                }
+
+                onChildUpdate(widget->m_parentIndex);
+                // Children report their own damage when moved or resized.
+                propagateDraw();
                 m_busy = false;
                 return true;
             }
             m_busy = false;
         }
+        else if (findEntry(widget) != nullptr)
+        {
+            // Child changed while handling another update (such as resized by a refit),
+            // the container is notified but the update is not propagated again.
+            if (batching())
+                m_batchChanged = true;
+            else
+                onChildUpdate(widget->m_parentIndex);
+        }
 
         return false;
     }
@@ -154,14 +263,11 @@ namespace pTK
         {
             m_busy = true;
 
-            auto it = std::find_if(m_holder.cbegin(), m_holder.cend(), [&widget](const auto& entry) {
-                return entry.get() == widget;
-            });
-
-            if (it != m_holder.cend())
+            if (findEntry(widget) != nullptr)
             {
-                onChildDraw(static_cast<size_type>(it - m_holder.cbegin()));
-                draw();
+                onChildDraw(widget->m_parentIndex);
+                // Only the child has been damaged, not the entire container.
+                propagateDraw();
                 m_busy = false;
                 return true;
             }
@@ -173,66 +279,66 @@ namespace pTK
 
     void WidgetContainer::onClickCallback(const ClickEvent& evt)
     {
-        ContainerEntryPair lastClicked{m_lastClickedWidget};
+        Widget* lastClicked{m_lastClickedWidget};
         bool found{false};
 
         auto it = findChildAtPos(evt.pos);
         if (it != cend())
         {
-            const auto work = [this, it, &found, &evt, dist = it - cbegin()]() {
-                m_lastClickedWidget = {(*it).get(), static_cast<std::size_t>(dist)};
+            const auto work = [this, it, &found, &evt]() {
+                m_lastClickedWidget = (*it).get();
                 found = true;
                 (*it)->handleEvent<ClickEvent>(evt);
             };
             DelayDeleteZone(*it, work);
         }
 
-        if (lastClicked.ptr != m_lastClickedWidget.ptr || !found)
+        if (lastClicked != m_lastClickedWidget || !found)
         {
-            if (validEntryPair(lastClicked))
+            if (const value_type* entry = findEntry(lastClicked))
             {
                 const auto work = [lastClicked, &evt]() {
                     LeaveClickEvent lcEvent{evt.button, evt.value, evt.pos};
-                    lastClicked.ptr->handleEvent<LeaveClickEvent>(lcEvent);
+                    lastClicked->handleEvent<LeaveClickEvent>(lcEvent);
                 };
-                DelayDeleteZone(m_holder[lastClicked.index], work);
+                DelayDeleteZone(*entry, work);
             }
         }
 
         if (!found)
-            m_lastClickedWidget = {};
+            m_lastClickedWidget = nullptr;
     }
 
     void WidgetContainer::onReleaseCallback(const ReleaseEvent& evt)
     {
-        if (validEntryPair(m_lastClickedWidget))
+        if (const value_type* entry = findEntry(m_lastClickedWidget))
         {
             const auto work = [this, &evt]() {
-                this->m_lastClickedWidget.ptr->handleEvent<ReleaseEvent>(evt);
+                this->m_lastClickedWidget->handleEvent<ReleaseEvent>(evt);
             };
-            DelayDeleteZone(m_holder[m_lastClickedWidget.index], work);
+            DelayDeleteZone(*entry, work);
         }
     }
 
     void WidgetContainer::onKeyCallback(const KeyEvent& evt)
     {
-        if (validEntryPair(m_lastClickedWidget))
+        if (const value_type* entry = findEntry(m_lastClickedWidget))
         {
             const auto work = [this, &evt]() {
-                this->m_lastClickedWidget.ptr->handleEvent<KeyEvent>(evt);
+                this->m_lastClickedWidget->handleEvent<KeyEvent>(evt);
             };
-            DelayDeleteZone(m_holder[m_lastClickedWidget.index], work);
+            DelayDeleteZone(*entry, work);
         }
     }
 
     void WidgetContainer::onInputCallback(const InputEvent& evt)
     {
-        if (validEntryPair(m_lastClickedWidget))
+        if (const value_type* entry = findEntry(m_lastClickedWidget))
         {
             const auto work = [this, &evt]() {
-                this->m_lastClickedWidget.ptr->handleEvent<InputEvent>(evt);
+                this->m_lastClickedWidget->handleEvent<InputEvent>(evt);
             };
-            DelayDeleteZone(m_holder[m_lastClickedWidget.index], work);
+            DelayDeleteZone(*entry, work);
         }
     }
 
@@ -241,20 +347,19 @@ namespace pTK
         auto it = findChildAtPos(evt.pos);
         if (it != cend())
         {
-            const auto work = [this, it, &evt, dist = it - cbegin()]() {
+            const auto work = [this, it, &evt]() {
                 // Send Leave Event.
-                if (m_currentHoverWidget.ptr != (*it).get() || m_currentHoverWidget.ptr == nullptr)
+                if (m_currentHoverWidget != (*it).get() || m_currentHoverWidget == nullptr)
                 {
-                    ContainerEntryPair temp{
-                        (*it).get(), static_cast<std::size_t>(dist)}; // Iterator might change, when passing the event.
+                    Widget* temp{(*it).get()}; // Iterator might change, when passing the event.
 
-                    if (this->validEntryPair(m_currentHoverWidget))
+                    if (const value_type* entry = this->findEntry(m_currentHoverWidget))
                     {
-                        const auto work2 = [evt, ptr = m_currentHoverWidget.ptr]() {
+                        const auto work2 = [evt, ptr = m_currentHoverWidget]() {
                             LeaveEvent lEvent{evt.pos};
                             ptr->handleEvent<LeaveEvent>(lEvent);
                         };
-                        DelayDeleteZone(this->m_holder[m_currentHoverWidget.index], work2);
+                        DelayDeleteZone(*entry, work2);
                     }
 
                     // New current hovered Widget.
@@ -262,61 +367,61 @@ namespace pTK
 
                     // Fire Enter event on this and on to child.
                     EnterEvent entEvent{evt.pos};
-                    m_currentHoverWidget.ptr->handleEvent<EnterEvent>(entEvent);
+                    m_currentHoverWidget->handleEvent<EnterEvent>(entEvent);
                 }
 
-                m_currentHoverWidget.ptr->handleEvent<MotionEvent>(evt);
+                m_currentHoverWidget->handleEvent<MotionEvent>(evt);
             };
             DelayDeleteZone(*it, work);
             return;
         }
 
-        if (this->validEntryPair(m_currentHoverWidget))
+        if (const value_type* entry = this->findEntry(m_currentHoverWidget))
         {
-            const auto work = [evt, ptr = m_currentHoverWidget.ptr]() {
+            const auto work = [evt, ptr = m_currentHoverWidget]() {
                 LeaveEvent lEvent{evt.pos};
                 ptr->handleEvent<LeaveEvent>(lEvent);
             };
-            DelayDeleteZone(this->m_holder[m_currentHoverWidget.index], work);
+            DelayDeleteZone(*entry, work);
         }
 
         // New current hovered Widget.
-        m_currentHoverWidget = {};
+        m_currentHoverWidget = nullptr;
     }
 
     void WidgetContainer::onEnterCallback(const EnterEvent& evt)
     {
-        if (this->validEntryPair(m_currentHoverWidget))
+        if (const value_type* entry = this->findEntry(m_currentHoverWidget))
         {
-            const auto work = [evt, ptr = m_currentHoverWidget.ptr]() {
+            const auto work = [evt, ptr = m_currentHoverWidget]() {
                 ptr->handleEvent<EnterEvent>(evt);
             };
-            DelayDeleteZone(this->m_holder[m_currentHoverWidget.index], work);
+            DelayDeleteZone(*entry, work);
         }
     }
 
     void WidgetContainer::onLeaveCallback(const LeaveEvent& evt)
     {
-        if (this->validEntryPair(m_currentHoverWidget))
+        if (const value_type* entry = this->findEntry(m_currentHoverWidget))
         {
-            const auto work = [this, evt, ptr = m_currentHoverWidget.ptr]() {
+            const auto work = [this, evt, ptr = m_currentHoverWidget]() {
                 ptr->handleEvent<LeaveEvent>(evt);
 
                 // Reset current hovered Widget.
-                m_currentHoverWidget = {};
+                m_currentHoverWidget = nullptr;
             };
-            DelayDeleteZone(this->m_holder[m_currentHoverWidget.index], work);
+            DelayDeleteZone(*entry, work);
         }
     }
 
     void WidgetContainer::onScrollCallback(const ScrollEvent& evt)
     {
-        if (this->validEntryPair(m_currentHoverWidget))
+        if (const value_type* entry = this->findEntry(m_currentHoverWidget))
         {
-            const auto work = [evt, ptr = m_currentHoverWidget.ptr]() {
+            const auto work = [evt, ptr = m_currentHoverWidget]() {
                 ptr->handleEvent<ScrollEvent>(evt);
             };
-            DelayDeleteZone(this->m_holder[m_currentHoverWidget.index], work);
+            DelayDeleteZone(*entry, work);
         }
     }
 
@@ -332,7 +437,7 @@ namespace pTK
 
     Widget* WidgetContainer::getSelectedWidget() const
     {
-        return m_lastClickedWidget.ptr;
+        return m_lastClickedWidget;
     }
 
     bool WidgetContainer::busy() const
@@ -388,13 +493,13 @@ namespace pTK
         });
 
         addListener<LeaveClickEvent>([container = this](const LeaveClickEvent& evt) {
-            if (container->validEntryPair(container->m_lastClickedWidget))
+            if (const value_type* entry = container->findEntry(container->m_lastClickedWidget))
             {
                 const auto work = [container, &evt]() {
-                    container->m_lastClickedWidget.ptr->handleEvent<LeaveClickEvent>(evt);
-                    container->m_lastClickedWidget = {};
+                    container->m_lastClickedWidget->handleEvent<LeaveClickEvent>(evt);
+                    container->m_lastClickedWidget = nullptr;
                 };
-                DelayDeleteZone(container->m_holder[container->m_lastClickedWidget.index], work);
+                DelayDeleteZone(*entry, work);
             }
             return false;
         });
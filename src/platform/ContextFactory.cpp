@@ -7,6 +7,7 @@
 
 // Local Headers
 #include "../Log.hpp"
+#include "headless/RasterContextHeadless.hpp"
 
 // pTK Headers
 #include "ptk/core/Defines.hpp"
@@ -39,9 +40,19 @@ namespace pTK::Platform
     std::unique_ptr<ContextBase> ContextFactory::Make(Window* window, const Size& size, const Vec2f& scale,
                                                       const WindowInfo& info)
     {
+        if (info.backend == WindowInfo::Backend::Headless)
+            return MakeHeadless(size, scale);
+
         return ContextFactoryImpl::MakeContext(window, size, scale, info);
     }
 
+    std::unique_ptr<ContextBase> ContextFactory::MakeHeadless(const Size& size, const Vec2f& scale)
+    {
+        const Size scaled{Size::MakeNarrow(static_cast<float>(size.width) * scale.x,
+                                           static_cast<float>(size.height) * scale.y)};
+        return std::make_unique<RasterContextHeadless>(scaled);
+    }
+
     std::unique_ptr<ContextBase> ContextFactory::MakeRaster(Window* window, const Size& size, const Vec2f& scale)
     {
         return ContextFactoryImpl::MakeRasterContext(window, size, scale);
@@ -42,7 +42,7 @@ namespace pTK::Platform
         if (!m_surface)
             throw ContextError("Failed to create Raster Context");
 
-        PTK_INFO("Sized RasterContext to {}x{}", size.width, size.height);
+        PTK_TRACE("Sized RasterContext to {}x{}", size.width, size.height);
         setSize(size);
     }
 
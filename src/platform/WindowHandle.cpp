@@ -8,6 +8,7 @@
 // Local Headers
 #include "../Log.hpp"
 #include "../core/Assert.hpp"
+#include "headless/WindowHandleHeadless.hpp"
 
 // pTK Headers
 #include "ptk/platform/WindowHandle.hpp"
@@ -24,7 +25,11 @@ namespace pTK::Platform
                                                      const WindowInfo& flags)
     {
         PTK_ASSERT(winBase, "WindowBase cannot be nullptr");
-        auto handle = WindowHandleFactoryImpl::Make(winBase, name, size, flags);
+        std::unique_ptr<WindowHandle> handle{};
+        if (flags.backend == WindowInfo::Backend::Headless)
+            handle = std::make_unique<WindowHandleHeadless>(winBase, name, size, flags);
+        else
+            handle = WindowHandleFactoryImpl::Make(winBase, name, size, flags);
         PTK_ASSERT(handle, "Failed to create ApplicationHandle");
 
         PTK_INFO("Created WindowHandle");
@@ -0,0 +1,31 @@
+//
+//  platform/headless/RasterContextHeadless.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// Local Headers
+#include "RasterContextHeadless.hpp"
+#include "../../Log.hpp"
+
+// C++ Headers
+#include <algorithm>
+
+namespace pTK::Platform
+{
+    RasterContextHeadless::RasterContextHeadless(const Size& size)
+        : RasterContext(kN32_SkColorType, size)
+    {
+        resize(size);
+        PTK_INFO("Initialized RasterContextHeadless");
+    }
+
+    void* RasterContextHeadless::onResize(const Size& size)
+    {
+        // Storage for at least one pixel, an empty vector might not have any storage.
+        const std::size_t count{static_cast<std::size_t>(size.width) * static_cast<std::size_t>(size.height)};
+        m_pixels.assign(std::max<std::size_t>(count, 1), 0);
+        return m_pixels.data();
+    }
+} // namespace pTK::Platform
@@ -0,0 +1,57 @@
+//
+//  platform/headless/RasterContextHeadless.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_PLATFORM_HEADLESS_RASTERCONTEXT_HPP
+#define PTK_PLATFORM_HEADLESS_RASTERCONTEXT_HPP
+
+// pTK Headers
+#include "ptk/platform/RasterContext.hpp"
+
+// C++ Headers
+#include <cstdint>
+#include <vector>
+
+namespace pTK::Platform
+{
+    /** RasterContextHeadless class implementation.
+
+        Raster Context that only renders to memory, used with WindowInfo::Backend::Headless.
+    */
+    class PTK_API RasterContextHeadless : public RasterContext
+    {
+    public:
+        /** Constructs RasterContextHeadless with size.
+
+            @param size     size of the context
+            @return         initialized RasterContextHeadless with size
+        */
+        explicit RasterContextHeadless(const Size& size);
+
+        /** Destructor for RasterContextHeadless.
+
+        */
+        ~RasterContextHeadless() override = default;
+
+        /** Function for resizing.
+
+            @param size     new size
+            @return         pointer to pixel storage
+        */
+        void* onResize(const Size& size) override;
+
+        /** Function to swap the buffers after drawing.
+
+            Nothing to present, the pixels are kept in memory.
+        */
+        void swapBuffers(const DamageRegion&) override {}
+
+    private:
+        std::vector<uint32_t> m_pixels{};
+    };
+} // namespace pTK::Platform
+
+#endif // PTK_PLATFORM_HEADLESS_RASTERCONTEXT_HPP
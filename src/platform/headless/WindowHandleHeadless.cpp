@@ -0,0 +1,82 @@
+//
+//  platform/headless/WindowHandleHeadless.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// Local Headers
+#include "WindowHandleHeadless.hpp"
+#include "../../Log.hpp"
+
+// pTK Headers
+#include "ptk/events/WindowEvent.hpp"
+
+namespace pTK::Platform
+{
+    WindowHandleHeadless::WindowHandleHeadless(WindowBase* base, const std::string& name, const Size& size,
+                                               const WindowInfo& flags)
+        : WindowHandle(base),
+          m_title{name},
+          m_pos{flags.position},
+          m_size{size}
+    {
+        PTK_INFO("Initialized WindowHandleHeadless");
+    }
+
+    bool WindowHandleHeadless::close()
+    {
+        m_hidden = true;
+        return true;
+    }
+
+    void WindowHandleHeadless::show()
+    {
+        m_hidden = false;
+    }
+
+    void WindowHandleHeadless::hide()
+    {
+        m_hidden = true;
+    }
+
+    bool WindowHandleHeadless::setPosHint(const Point& pos)
+    {
+        m_pos = pos;
+        return true;
+    }
+
+    bool WindowHandleHeadless::resize(const Size& size)
+    {
+        m_size = size;
+        return true;
+    }
+
+    bool WindowHandleHeadless::setTitle(const std::string& name)
+    {
+        m_title = name;
+        return true;
+    }
+
+    bool WindowHandleHeadless::setIcon(int32_t, int32_t, uint8_t*)
+    {
+        return true;
+    }
+
+    bool WindowHandleHeadless::minimize()
+    {
+        m_minimized = true;
+        return true;
+    }
+
+    bool WindowHandleHeadless::restore()
+    {
+        m_minimized = false;
+        return true;
+    }
+
+    void WindowHandleHeadless::invalidate()
+    {
+        handlePlatformEvent<PaintEvent>({{0, 0}, getSize()});
+    }
+} // namespace pTK::Platform
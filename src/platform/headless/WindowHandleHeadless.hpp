@@ -0,0 +1,145 @@
+//
+//  platform/headless/WindowHandleHeadless.hpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+#ifndef PTK_PLATFORM_HEADLESS_WINDOWHANDLE_HPP
+#define PTK_PLATFORM_HEADLESS_WINDOWHANDLE_HPP
+
+// pTK Headers
+#include "ptk/platform/WindowHandle.hpp"
+
+// C++ Headers
+#include <string>
+
+namespace pTK::Platform
+{
+    /** WindowHandleHeadless class implementation.
+
+        Window without a platform window, used with WindowInfo::Backend::Headless.
+        The state is only stored and no display connection is needed.
+        Invalidating the window paints it directly.
+    */
+    class PTK_API WindowHandleHeadless : public WindowHandle
+    {
+    public:
+        /** Constructs WindowHandleHeadless with values.
+
+            @param base     valid pointer to window base
+            @param name     name of the window
+            @param size     size of the window
+            @param flags    initial window settings
+            @return         initialized WindowHandleHeadless with values
+        */
+        WindowHandleHeadless(WindowBase* base, const std::string& name, const Size& size, const WindowInfo& flags);
+
+        /** Destructor for WindowHandleHeadless.
+
+        */
+        ~WindowHandleHeadless() override = default;
+
+        /** Function for closing the window.
+
+            @return     true
+        */
+        bool close() override;
+
+        /** Function for showing the window.
+
+        */
+        void show() override;
+
+        /** Function for hiding the window.
+
+        */
+        void hide() override;
+
+        /** Function for retrieving if the window is hidden.
+
+            @return     true if window is hidden, otherwise false
+        */
+        [[nodiscard]] bool isHidden() const override { return m_hidden; }
+
+        /** Function for setting the position of the window.
+
+            @param pos  position to set
+            @return     true
+        */
+        bool setPosHint(const Point& pos) override;
+
+        /** Function for resizing the window.
+
+            @param size  size to set
+            @return     true
+        */
+        bool resize(const Size& size) override;
+
+        /** Function for setting the title of the window.
+
+            @param name     title to show
+            @return         true
+        */
+        bool setTitle(const std::string& name) override;
+
+        /** Function for setting the icon of the window.
+
+            Icons are ignored.
+
+            @return         true
+        */
+        bool setIcon(int32_t width, int32_t height, uint8_t* pixels) override;
+
+        /** Function for retrieving the window position.
+
+            @return     Window Position
+        */
+        [[nodiscard]] Point getPosition() const override { return m_pos; }
+
+        /** Function for retrieving the window size.
+
+            @return     Window Size
+        */
+        [[nodiscard]] Size getSize() const override { return m_size; }
+
+        /** Function for minimizing the window.
+
+            @return     true
+        */
+        bool minimize() override;
+
+        /** Function for retrieving the minimizing status of the window.
+
+            @return     true if window is minimized, otherwise false
+        */
+        [[nodiscard]] bool isMinimized() const override { return m_minimized; }
+
+        /** Function for restoring a window from the minimized state.
+
+            @return     true
+        */
+        bool restore() override;
+
+        /** Function for retrieving the focus status of the window.
+
+            @return     false, never focused
+        */
+        [[nodiscard]] bool isFocused() const override { return false; }
+
+        /** Function for invalidating the window.
+
+            Sends a PaintEvent to the window directly.
+        */
+        void invalidate() override;
+
+    private:
+        std::string m_title;
+        Point m_pos;
+        Size m_size;
+        bool m_hidden{true};
+        bool m_minimized{false};
+    };
+} // namespace pTK::Platform
+
+#endif // PTK_PLATFORM_HEADLESS_WINDOWHANDLE_HPP
@@ -62,7 +62,7 @@ namespace pTK::Platform
         /** Function for swapping the buffers
 
         */
-        void swapBuffers() override;
+        void swapBuffers(const DamageRegion&) override;
 
     private:
         void init(void* mainView, const Size& size, const Vec2f& scale);
@@ -123,7 +123,7 @@ namespace pTK::Platform
             m_metalLayer.drawableSize = rect.size;
             m_metalLayer.frame = m_mainView.frame;
             setSize(size);
-            PTK_INFO("Sized MetalContextMac to {}x{}", size.width, size.height);
+            PTK_TRACE("Sized MetalContextMac to {}x{}", size.width, size.height);
         } // autoreleasepool
     }
 
@@ -159,7 +159,7 @@ namespace pTK::Platform
         } // autoreleasepool
     }
 
-    void MetalContextMac::swapBuffers()
+    void MetalContextMac::swapBuffers(const DamageRegion&)
     {
         @autoreleasepool
         {
@@ -56,7 +56,7 @@ namespace pTK::Platform
         /** Function for swapping the buffers.
 
         */
-        void swapBuffers() override;
+        void swapBuffers(const DamageRegion&) override;
 
     private:
         NSWindow* m_window;
@@ -60,7 +60,7 @@ namespace pTK::Platform
         }
     }
 
-    void RasterContextMac::swapBuffers()
+    void RasterContextMac::swapBuffers(const DamageRegion&)
     {
         @autoreleasepool
         {
@@ -252,7 +252,7 @@ static bool IsValid(uint32 data)
     uint32 data{0};
 
     pTK::KeyEvent press{pTK::Event::Type::KeyPressed, pTK::KeyMap::KeyCodeToKey(static_cast<uint8_t>(event.keyCode)),
-                        data, pTK::Text::Encoding::UTF32, mods};
+                        data, mods};
     ptkWindow->handlePlatformEvent<pTK::KeyEvent>(press);
 
     if ([event.characters canBeConvertedToEncoding:NSUTF32StringEncoding])
@@ -263,22 +263,20 @@ static bool IsValid(uint32 data)
 
         if (count > 0)
         {
+            // Sent in events of at most InputEvent::capacity code points.
+            pTK::InputEvent::data_type codepoints[pTK::InputEvent::capacity];
             std::size_t validCount{0};
             for (std::size_t i{1}; i < count; ++i)
-                if (IsValid(utf32[i]))
-                    ++validCount;
-
-            if (validCount > 0)
             {
-                pTK::InputEvent::data_cont arr(new pTK::InputEvent::data_type[validCount]);
-                std::size_t index{0};
-                for (std::size_t i{1}; i < count; ++i)
-                    if (IsValid(utf32[i]))
-                        arr[index++] = utf32[i];
-
-                // Trigger event.
-                pTK::InputEvent input{arr, validCount, pTK::Text::Encoding::UTF32};
-                ptkWindow->handlePlatformEvent<pTK::InputEvent>(input);
+                if (IsValid(utf32[i]))
+                    codepoints[validCount++] = utf32[i];
+
+                if ((validCount == pTK::InputEvent::capacity) || ((i + 1 == count) && (validCount > 0)))
+                {
+                    pTK::InputEvent input{codepoints, validCount};
+                    ptkWindow->handlePlatformEvent<pTK::InputEvent>(input);
+                    validCount = 0;
+                }
             }
         }
     }
@@ -657,22 +655,20 @@ namespace pTK::Platform
         handlePlatformEvent<PaintEvent>({{0, 0}, getSize()});
     }
 
-    static long GetMonitorRefreshRate() noexcept
+    static long GetMonitorRefreshRate(NSWindow* nswindow) noexcept
     {
-        if (auto screen = [NSScreen mainScreen])
-        {
-            const long refreshRate = screen.maximumFramesPerSecond;
-            PTK_INFO("[macOS] Found (main) monitor refresh rate as {}Hz", refreshRate);
-            return refreshRate;
-        }
+        // Screen the window is on, or the main screen if it is not on any.
+        NSScreen* screen = (nswindow && nswindow.screen) ? nswindow.screen : [NSScreen mainScreen];
+        if (screen)
+            return screen.maximumFramesPerSecond;
 
         return -1;
     }
 
     std::size_t WindowHandleMac::targetRefreshRate() const noexcept
     {
-        static auto rate = static_cast<std::size_t>(GetMonitorRefreshRate());
-        return (rate > 0) ? rate : WindowHandle::targetRefreshRate();
+        const long rate = GetMonitorRefreshRate(static_cast<NSWindow*>(m_NSWindow));
+        return (rate > 0) ? static_cast<std::size_t>(rate) : WindowHandle::targetRefreshRate();
     }
 
     long WindowHandleMac::windowID() const
@@ -15,7 +15,23 @@
 #include "ptk/Application.hpp"
 #include "ptk/core/Event.hpp"
 #include "ptk/core/Exception.hpp"
+#include "ptk/core/Profiler.hpp"
 #include "ptk/events/KeyMap.hpp"
+#include "ptk/util/UTF.hpp"
+
+// C Headers
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+    #include <sys/eventfd.h>
+#endif
+
+// C++ Headers
+#include <cerrno>
+#include <cstdint>
+#include <string_view>
+#include <vector>
 
 //
 // TODO(knobin): Go through this file and check that Window events are handled properly.
@@ -44,6 +60,11 @@ namespace pTK::Platform
         return handle->m_lastPos;
     }
 
+    double& WindowRefreshRate(WindowHandleUnix* handle)
+    {
+        return handle->m_refreshRate;
+    }
+
     struct AppUnixData
     {
         Display* display{nullptr};
@@ -52,12 +73,62 @@ namespace pTK::Platform
         ::Window root;
         XIM xim;
         XIC xic;
+
+        // Wakeup descriptors, read and write are the same for eventfd.
+        int wakeupRead{-1};
+        int wakeupWrite{-1};
     };
 
     static AppUnixData s_appData{};
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+    static void OpenWakeup()
+    {
+#if defined(__linux__)
+        const int fd{eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)};
+        if (fd != -1)
+        {
+            s_appData.wakeupRead = fd;
+            s_appData.wakeupWrite = fd;
+            return;
+        }
+#endif
+
+        // Self-pipe fallback.
+        int fds[2];
+        if (pipe(fds) == -1)
+            throw PlatformError("Could not create wakeup descriptor");
+
+        for (int pipeFd : fds)
+        {
+            fcntl(pipeFd, F_SETFL, fcntl(pipeFd, F_GETFL) | O_NONBLOCK);
+            fcntl(pipeFd, F_SETFD, FD_CLOEXEC);
+        }
+
+        s_appData.wakeupRead = fds[0];
+        s_appData.wakeupWrite = fds[1];
+    }
+
+    static void CloseWakeup()
+    {
+        if (s_appData.wakeupWrite != s_appData.wakeupRead)
+            close(s_appData.wakeupWrite);
+        close(s_appData.wakeupRead);
+        s_appData.wakeupRead = -1;
+        s_appData.wakeupWrite = -1;
+    }
+
+    static void DrainWakeup()
+    {
+        // Both the eventfd counter and the pipe are emptied by reading until EAGAIN.
+        uint64_t buffer[8];
+        while (read(s_appData.wakeupRead, buffer, sizeof(buffer)) > 0)
+            ;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+
     ApplicationHandleUnix::ApplicationHandleUnix(ApplicationBase* base, std::string_view)
         : ApplicationHandle(base)
     {
@@ -69,71 +140,110 @@ namespace pTK::Platform
         s_appData.root = RootWindow(s_appData.display, s_appData.screen);
         s_appData.xim = XOpenIM(s_appData.display, 0, 0, 0);
         s_appData.xic = XCreateIC(s_appData.xim, XNInputStyle, XIMPreeditNothing | XIMStatusNothing, NULL);
+        OpenWakeup();
 
         PTK_INFO("Initialized ApplicationHandleUnix");
     }
 
     ApplicationHandleUnix::~ApplicationHandleUnix()
     {
+        CloseWakeup();
         XCloseDisplay(s_appData.display);
         PTK_INFO("Destroyed ApplicationHandleUnix");
     }
 
     void ApplicationHandleUnix::pollEvents()
     {
-        XPending(s_appData.display);
-
-        while (QLength(s_appData.display))
-        {
-            XEvent event = {};
-            XNextEvent(s_appData.display, &event);
-            handleEvent(&event);
-        }
-
-        XFlush(s_appData.display);
+        waitForEvents(0);
+        processEvents();
     }
 
     void ApplicationHandleUnix::waitEvents()
     {
-        XEvent event = {};
-        XNextEvent(s_appData.display, &event);
-        handleEvent(&event);
-        pollEvents();
+        // Block until an event or a wakeup exists.
+        waitForEvents(-1);
+        processEvents();
     }
 
     void ApplicationHandleUnix::waitEventsTimeout(uint32_t ms)
+    {
+        if (waitForEvents(static_cast<int>(ms)))
+            processEvents();
+    }
+
+    static uint32_t ToWatchEvents(short revents)
+    {
+        uint32_t events{0};
+        if (revents & POLLIN)
+            events |= EventSources::Readable;
+        if (revents & POLLOUT)
+            events |= EventSources::Writable;
+        if (revents & (POLLERR | POLLHUP | POLLNVAL))
+            events |= EventSources::Error;
+        if (revents & POLLNVAL)
+            events |= EventSources::Invalid;
+        return events;
+    }
+
+    bool ApplicationHandleUnix::waitForEvents(int timeout)
     {
         ::Display* display{s_appData.display};
-        XEvent event = {};
-        bool evtFound{false};
 
-        timeval timeout{};
-        timeout.tv_sec = ms / 1000;
-        timeout.tv_usec = (ms * 1000) - (timeout.tv_sec * 1000000);
+        // XPending flushes the output buffer and reads what is already available,
+        // the watchers are then only checked and not waited on.
+        const bool pending{XPending(display) > 0};
 
-        if (XPending(display) == 0)
+        m_pollFds.clear();
+        m_pollIds.clear();
+        m_pollFds.push_back(pollfd{ConnectionNumber(display), POLLIN, 0});
+        m_pollFds.push_back(pollfd{s_appData.wakeupRead, POLLIN, 0});
+        for (const EventSources::Watch& watch : eventSources().watches())
         {
-            int fd{ConnectionNumber(display)};
-            fd_set readset;
-            FD_ZERO(&readset);
-            FD_SET(fd, &readset);
-            if (select(fd + 1, &readset, nullptr, nullptr, &timeout) > 0)
-            {
-                XNextEvent(display, &event);
-                evtFound = true;
-            }
+            int events{0};
+            if (watch.events & EventSources::Readable)
+                events |= POLLIN;
+            if (watch.events & EventSources::Writable)
+                events |= POLLOUT;
+            m_pollFds.push_back(pollfd{watch.fd, static_cast<short>(events), 0});
+            m_pollIds.push_back(watch.id);
         }
-        else
+
+        int result{-1};
+        do
         {
-            XNextEvent(display, &event);
-            evtFound = true;
-        }
+            result = poll(m_pollFds.data(), static_cast<nfds_t>(m_pollFds.size()), pending ? 0 : timeout);
+        } while ((result == -1) && (errno == EINTR));
+
+        if (result <= 0)
+            return pending;
+
+        if (m_pollFds[1].revents & POLLIN)
+            DrainWakeup();
+
+        for (std::size_t i{2}; i < m_pollFds.size(); ++i)
+            if (m_pollFds[i].revents != 0)
+                eventSources().dispatchWatch(m_pollIds[i - 2], ToWatchEvents(m_pollFds[i].revents));
 
-        if (evtFound)
+        return true;
+    }
+
+    void ApplicationHandleUnix::processEvents()
+    {
+        // Read what is available on the connection.
+        XPending(s_appData.display);
+
+        // Drain the queue first, so that stale events can be coalesced.
+        m_events.clear();
+        while (QLength(s_appData.display))
         {
-            handleEvent(&event);
-            pollEvents();
+            XEvent event = {};
+            XNextEvent(s_appData.display, &event);
+            m_events.push_back(event);
         }
+
+        dispatchEvents();
+
+        XFlush(s_appData.display);
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -158,6 +268,13 @@ namespace pTK::Platform
         return s_appData.screen;
     }
 
+    void ApplicationHandleUnix::Wakeup()
+    {
+        // A full pipe or eventfd counter already guarantees a wakeup, EAGAIN is ignored.
+        const uint64_t value{1};
+        [[maybe_unused]] const ssize_t written{write(s_appData.wakeupWrite, &value, sizeof(value))};
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
 
     static std::underlying_type<KeyEvent::Modifier>::type GetKeyModifiers(int state)
@@ -186,13 +303,109 @@ namespace pTK::Platform
         return mods;
     }
 
+    // Sends UTF-8 text in InputEvents of at most InputEvent::capacity code points.
+    static void SendInput(WindowHandleUnix* handle, const char* text, std::size_t size)
+    {
+        PTK_TRACE("INPUT EVENT: {}", std::string_view(text, size));
+
+        InputEvent::data_type codepoints[InputEvent::capacity];
+        while (size > 0)
+        {
+            const UTF::DecodeResult result{UTF::DecodeUTF8(text, size, codepoints, InputEvent::capacity)};
+            InputEvent input{codepoints, result.written};
+            handle->handlePlatformEvent<InputEvent>(input);
+
+            text += result.read;
+            size -= result.read;
+        }
+    }
+
+    static WindowHandleUnix* FindWindowHandle(::Window window)
+    {
+        WindowHandleUnix* handle{nullptr};
+        if (XFindContext(s_appData.display, window, s_appData.xcontext, reinterpret_cast<XPointer*>(&handle)) != 0)
+            return nullptr;
+        return handle;
+    }
+
+    static bool IsScrollEvent(const XEvent& event)
+    {
+        return ((event.type == ButtonPress) || (event.type == ButtonRelease)) &&
+               ((event.xbutton.button == Button4) || (event.xbutton.button == Button5));
+    }
+
+    // Events that only the last one of is relevant if several arrive in a row.
+    static bool IsCoalescable(const XEvent& event)
+    {
+        return (event.type == MotionNotify) || (event.type == ConfigureNotify);
+    }
+
+    void ApplicationHandleUnix::dispatchEvents()
+    {
+        PTK_PROFILE_ZONE("ApplicationHandle::dispatchEvents");
+
+        const bool coalesce{eventCoalescing()};
+        uint64_t coalesced{0};
+
+        const std::size_t count{m_events.size()};
+        for (std::size_t i{0}; i < count; ++i)
+        {
+            XEvent& event{m_events[i]};
+
+            if (coalesce && IsCoalescable(event) && (i + 1 < count))
+            {
+                const XEvent& next{m_events[i + 1]};
+                if ((next.type == event.type) && (next.xany.window == event.xany.window))
+                {
+                    // Superseded by the next event.
+                    ++coalesced;
+                    continue;
+                }
+            }
+
+            if (coalesce && IsScrollEvent(event))
+            {
+                // Sum the deltas of a run of scroll events for the same window.
+                // X reports each wheel step as a press and release of button 4 or 5,
+                // the releases are ignored (as they would be in handleEvent).
+                int delta{0};
+                uint64_t presses{0};
+                std::size_t j{i};
+                for (; (j < count) && IsScrollEvent(m_events[j]) && (m_events[j].xany.window == event.xany.window);
+                     ++j)
+                {
+                    if (m_events[j].type == ButtonPress)
+                    {
+                        delta += (m_events[j].xbutton.button == Button4) ? 1 : -1;
+                        ++presses;
+                    }
+                }
+                i = j - 1;
+
+                // Steps in opposite directions that cancel out are not sent at all.
+                if (delta != 0)
+                {
+                    coalesced += presses - 1;
+                    if (WindowHandleUnix* handle = FindWindowHandle(event.xany.window))
+                        handle->handlePlatformEvent<ScrollEvent>(ScrollEvent{{0.0f, static_cast<float>(delta)}});
+                }
+                else
+                    coalesced += presses;
+                continue;
+            }
+
+            handleEvent(&event);
+        }
+
+        addCoalescedEvents(coalesced);
+    }
+
     void ApplicationHandleUnix::handleEvent(XEvent* event)
     {
         PTK_ASSERT(event, "Undefined XEvent!");
 
-        WindowHandleUnix* handle{nullptr};
-        if (XFindContext(s_appData.display, event->xany.window, s_appData.xcontext,
-                         reinterpret_cast<XPointer*>(&handle)) != 0)
+        WindowHandleUnix* handle{FindWindowHandle(event->xany.window)};
+        if (handle == nullptr)
             return;
 
         switch (event->type)
@@ -272,21 +485,22 @@ namespace pTK::Platform
                 if ((type == KeyEvent::Pressed) && (key != Key::Delete) && // Quick fix for now.
                     (key != Key::Backspace) && (key != Key::Enter))
                 {
-                    char buffer[32];
+                    char buffer[pTK::InputEvent::capacity];
                     KeySym ignore;
                     x11::Status return_status;
                     int count = {0};
-                    count = Xutf8LookupString(s_appData.xic, &event->xkey, buffer, 32, &ignore, &return_status);
-                    if (count)
+                    count = Xutf8LookupString(s_appData.xic, &event->xkey, buffer, sizeof(buffer), &ignore,
+                                              &return_status);
+                    if ((count > 0) && (return_status != XBufferOverflow))
+                        SendInput(handle, buffer, static_cast<std::size_t>(count));
+                    else if (return_status == XBufferOverflow)
                     {
-                        PTK_INFO("INPUT EVENT: {} {}", buffer, count);
-                        pTK::InputEvent::data_cont arr(new pTK::InputEvent::data_type[static_cast<std::size_t>(count)]);
-
-                        for (std::size_t i{0}; i < static_cast<std::size_t>(count); ++i)
-                            arr[i] = static_cast<uint32_t>(buffer[i]);
-
-                        pTK::InputEvent input{arr, static_cast<std::size_t>(count), pTK::Text::Encoding::UTF32};
-                        handle->handlePlatformEvent<pTK::InputEvent>(input);
+                        // Long text (such as IME commits), count is the size needed.
+                        std::vector<char> text(static_cast<std::size_t>(count));
+                        count = Xutf8LookupString(s_appData.xic, &event->xkey, text.data(), count, &ignore,
+                                                  &return_status);
+                        if (count > 0)
+                            SendInput(handle, text.data(), static_cast<std::size_t>(count));
                     }
                 }
 
@@ -322,6 +536,9 @@ namespace pTK::Platform
                 {
                     wPos.x = static_cast<Point::value_type>(event->xconfigure.x);
                     wPos.y = static_cast<Point::value_type>(event->xconfigure.y);
+
+                    // Might be on another monitor now.
+                    WindowRefreshRate(handle) = 0.0;
                     handle->handlePlatformEvent<MoveEvent>(MoveEvent{wPos});
                 }
 
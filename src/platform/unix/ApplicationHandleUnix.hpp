@@ -14,6 +14,12 @@
 // pTK Headers
 #include "ptk/platform/ApplicationHandle.hpp"
 
+// C Headers
+#include <poll.h>
+
+// C++ Headers
+#include <vector>
+
 namespace pTK::Platform
 {
     /** ApplicationHandleUnix class implementation.
@@ -53,6 +59,12 @@ namespace pTK::Platform
         */
         void waitEventsTimeout(uint32_t ms) override;
 
+        /** Function for checking if file descriptor watchers are waited on.
+
+            @return     true
+        */
+        [[nodiscard]] bool supportsWatches() const noexcept override { return true; }
+
     public:
         /** Function for retrieving the xlib Display structure.
 
@@ -78,9 +90,35 @@ namespace pTK::Platform
         */
         static int Screen();
 
+        /** Function for waking up the event loop from any thread.
+
+            Wakes up a thread blocked in waitEvents or waitEventsTimeout
+            without a round-trip to the X server.
+            Note: This function is thread safe.
+        */
+        static void Wakeup();
+
     private:
+        // Waits on the X connection, the wakeup descriptor and the watchers.
+        // Returns true if there might be X events to handle.
+        bool waitForEvents(int timeout);
+
+        // Drains and dispatches the X events.
+        void processEvents();
+
         // Helper for handling a XEvent.
         void handleEvent(XEvent* event);
+
+        // Dispatches the drained events, coalesced if enabled.
+        void dispatchEvents();
+
+    private:
+        // Events drained from the X queue, reused between polls.
+        std::vector<XEvent> m_events{};
+
+        // Descriptors to poll and the watcher ids (from index 2), reused between waits.
+        std::vector<pollfd> m_pollFds{};
+        std::vector<EventSources::id_type> m_pollIds{};
     };
 } // namespace pTK::Platform
 
@@ -268,7 +268,7 @@ namespace pTK::Platform
             m_surface.reset(surface);
 
             // clear(Color{0xFFFFFFFF});
-            PTK_INFO("Sized GLContextUnix to {}x{}", size.width, size.height);
+            PTK_TRACE("Sized GLContextUnix to {}x{}", size.width, size.height);
             setSize(size);
         }
     }
@@ -278,7 +278,7 @@ namespace pTK::Platform
         return m_surface;
     }
 
-    void GLContextUnix::swapBuffers()
+    void GLContextUnix::swapBuffers(const DamageRegion&)
     {
         glXSwapBuffers(App::Display(), m_window);
     }
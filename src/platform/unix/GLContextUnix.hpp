@@ -68,7 +68,7 @@ namespace pTK::Platform
         /** Function for swapping the buffers
 
         */
-        void swapBuffers() override;
+        void swapBuffers(const DamageRegion&) override;
 
     private:
         ::Window m_window;
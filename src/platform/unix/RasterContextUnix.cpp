@@ -7,8 +7,16 @@
 
 // Local Headers
 #include "RasterContextUnix.hpp"
+#include "../../Log.hpp"
 #include "ApplicationHandleUnix.hpp"
 
+// C++ Headers
+#include <cstdlib>
+
+// Unix Headers
+#include <sys/ipc.h>
+#include <sys/shm.h>
+
 // Skia Headers
 PTK_DISABLE_WARN_BEGIN()
 #include "include/core/SkSurface.h"
@@ -18,53 +26,178 @@ namespace pTK::Platform
 {
     using App = ApplicationHandleUnix;
 
+    // XShmAttach will fail asynchronously when the X server is not on the same machine.
+    static bool s_shmAttachFailed{false};
+
+    static int ShmErrorHandler(Display*, XErrorEvent*)
+    {
+        s_shmAttachFailed = true;
+        return 0;
+    }
+
+    static bool IsShmAvailable()
+    {
+        if (std::getenv("PTK_X11_NO_SHM") != nullptr)
+            return false;
+
+        return XShmQueryExtension(App::Display()) == True;
+    }
+
     RasterContextUnix::RasterContextUnix(::Window window, const Size& size, XVisualInfo info)
         : RasterContext(kBGRA_8888_SkColorType, size),
           m_window{window},
           m_info{info},
-          m_image{nullptr}
+          m_image{nullptr},
+          m_useShm{IsShmAvailable()}
     {
         m_gc = XCreateGC(App::Display(), m_window, 0, nullptr);
         resize(size);
+        PTK_INFO("RasterContextUnix presenting with {}", (m_useShm) ? "MIT-SHM" : "XPutImage");
     }
 
     RasterContextUnix::~RasterContextUnix()
     {
-        delete[] static_cast<uint32_t*>(m_buffer);
+        destroyImage();
+        XFreeGC(App::Display(), m_gc);
     }
 
     void* RasterContextUnix::onResize(const Size& size)
     {
-        if (m_image)
-        {
-            // XDestroyImage frees both the image structure and the data pointer.
-            m_image->data = nullptr;
-            XDestroyImage(m_image);
-            m_image = nullptr;
-            delete[] static_cast<uint32_t*>(m_buffer);
-        }
+        destroyImage();
 
         const auto width{static_cast<unsigned int>(size.width)};
         const auto height{static_cast<unsigned int>(size.height)};
 
+        if (m_useShm)
+        {
+            if (void* pixels = createShmImage(width, height))
+                return pixels;
+
+            // Fall back to XPutImage from now on.
+            PTK_WARN("Failed to create MIT-SHM image, falling back to XPutImage");
+            m_useShm = false;
+        }
+
+        return createImage(width, height);
+    }
+
+    void* RasterContextUnix::createShmImage(unsigned int width, unsigned int height)
+    {
+        m_image = XShmCreateImage(App::Display(), m_info.visual, 24, ZPixmap, nullptr, &m_shmInfo, width, height);
+        if (m_image == nullptr)
+            return nullptr;
+
+        // RasterContext expects tightly packed rows.
+        const auto rowBytes{static_cast<std::size_t>(m_image->bytes_per_line)};
+        if (rowBytes != sizeof(uint32_t) * width)
+        {
+            destroyImage();
+            return nullptr;
+        }
+
+        m_shmInfo.shmid = shmget(IPC_PRIVATE, rowBytes * height, IPC_CREAT | 0600);
+        if (m_shmInfo.shmid < 0)
+        {
+            destroyImage();
+            return nullptr;
+        }
+
+        m_shmInfo.shmaddr = static_cast<char*>(shmat(m_shmInfo.shmid, nullptr, 0));
+        if (m_shmInfo.shmaddr == reinterpret_cast<char*>(-1))
+        {
+            shmctl(m_shmInfo.shmid, IPC_RMID, nullptr);
+            m_shmInfo.shmaddr = nullptr;
+            destroyImage();
+            return nullptr;
+        }
+        m_image->data = m_shmInfo.shmaddr;
+        m_shmInfo.readOnly = False;
+
+        // Errors from XShmAttach are reported after a round-trip.
+        s_shmAttachFailed = false;
+        auto oldHandler = XSetErrorHandler(ShmErrorHandler);
+        XShmAttach(App::Display(), &m_shmInfo);
+        XSync(App::Display(), False);
+        XSetErrorHandler(oldHandler);
+
+        // Segment will be removed when both the X server and pTK has detached.
+        shmctl(m_shmInfo.shmid, IPC_RMID, nullptr);
+
+        if (s_shmAttachFailed)
+        {
+            destroyImage();
+            return nullptr;
+        }
+        m_shmAttached = true;
+
+        return m_shmInfo.shmaddr;
+    }
+
+    void* RasterContextUnix::createImage(unsigned int width, unsigned int height)
+    {
         m_buffer = new (std::nothrow) uint32_t[width * height];
         if (m_buffer == nullptr)
             return nullptr;
 
-        // const auto width = static_cast<unsigned int>(size.width);
-        // const auto height = static_cast<unsigned int>(size.height);
         m_image = XCreateImage(App::Display(), m_info.visual, 24, ZPixmap, 0, reinterpret_cast<char*>(m_buffer), width,
                                height, 32, 0);
 
         return m_buffer;
     }
 
-    void RasterContextUnix::swapBuffers()
+    void RasterContextUnix::destroyImage()
     {
-        const auto size{getSize()};
-        const auto width = static_cast<unsigned int>(size.width);
-        const auto height = static_cast<unsigned int>(size.height);
+        if (m_shmAttached)
+        {
+            XShmDetach(App::Display(), &m_shmInfo);
+            XSync(App::Display(), False);
+            m_shmAttached = false;
+        }
+
+        if (m_image)
+        {
+            // XDestroyImage frees both the image structure and the data pointer.
+            m_image->data = nullptr;
+            XDestroyImage(m_image);
+            m_image = nullptr;
+        }
+
+        if (m_shmInfo.shmaddr != nullptr)
+        {
+            shmdt(m_shmInfo.shmaddr);
+            m_shmInfo.shmaddr = nullptr;
+        }
+
+        delete[] m_buffer;
+        m_buffer = nullptr;
+    }
+
+    void RasterContextUnix::swapBuffers(const DamageRegion& damage)
+    {
+        const Rect surfaceRect{{0, 0}, getSize()};
+
+        for (const Rect& rect : damage)
+        {
+            const Rect area{rect.intersected(surfaceRect)};
+            if (area.isEmpty())
+                continue;
+
+            const int x{static_cast<int>(area.pos.x)};
+            const int y{static_cast<int>(area.pos.y)};
+            const unsigned int width{static_cast<unsigned int>(area.size.width)};
+            const unsigned int height{static_cast<unsigned int>(area.size.height)};
+
+            if (m_useShm)
+                XShmPutImage(App::Display(), m_window, m_gc, m_image, x, y, x, y, width, height, False);
+            else
+                XPutImage(App::Display(), m_window, m_gc, m_image, x, y, x, y, width, height);
+
+            m_presentedBytes += static_cast<std::size_t>(width) * height * sizeof(uint32_t);
+        }
 
-        XPutImage(App::Display(), m_window, m_gc, m_image, 0, 0, 0, 0, width, height);
+        // The X server reads directly from the shared memory, it must be done with
+        // it before the next frame is drawn to the buffer.
+        if (m_useShm)
+            XSync(App::Display(), False);
     }
 } // namespace pTK::Platform
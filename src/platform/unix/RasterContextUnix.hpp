@@ -24,6 +24,10 @@ namespace pTK::Platform
     /** RasterContextUnix class implementation.
 
         Raster Context for the Unix backend.
+
+        Pixels are presented with the MIT-SHM extension if the X server supports it
+        (local connection), otherwise they are sent over the connection with XPutImage.
+        Set the environment variable PTK_X11_NO_SHM to always use XPutImage.
     */
     class PTK_API RasterContextUnix : public RasterContext
     {
@@ -56,8 +60,33 @@ namespace pTK::Platform
 
         /** Function to swap the buffers after drawing.
 
+            Only the damaged rectangles are sent to the X server.
+
+            @param damage   damaged region in pixels
+        */
+        void swapBuffers(const DamageRegion& damage) override;
+
+        /** Function for checking if the MIT-SHM extension is used for presenting.
+
+            @return    status
+        */
+        [[nodiscard]] bool usingSharedMemory() const noexcept { return m_useShm; }
+
+        /** Function for retrieving the amount of pixel bytes presented since creation.
+
+            @return    bytes
         */
-        void swapBuffers() override;
+        [[nodiscard]] std::size_t presentedBytes() const noexcept { return m_presentedBytes; }
+
+    private:
+        // Creates the XImage and pixel storage in shared memory, returns nullptr on failure.
+        void* createShmImage(unsigned int width, unsigned int height);
+
+        // Creates the XImage and pixel storage in process memory, returns nullptr on failure.
+        void* createImage(unsigned int width, unsigned int height);
+
+        // Releases the XImage and the pixel storage.
+        void destroyImage();
 
     private:
         ::Window m_window;
@@ -65,6 +94,10 @@ namespace pTK::Platform
         XImage* m_image;
         GC m_gc;
         uint32_t* m_buffer{nullptr};
+        XShmSegmentInfo m_shmInfo{};
+        std::size_t m_presentedBytes{0};
+        bool m_useShm{false};
+        bool m_shmAttached{false};
     };
 } // namespace pTK::Platform
 
@@ -16,6 +16,7 @@
 #include "ptk/core/Exception.hpp"
 
 // C++ Headers
+#include <cmath>
 #include <cstdint>
 #include <limits>
 
@@ -155,7 +156,7 @@ namespace pTK::Platform
 
         if (size != getSize())
         {
-            PTK_INFO("bool WindowHandleUnix::resize(const Size& size)");
+            PTK_TRACE("bool WindowHandleUnix::resize(const Size& size)");
             const unsigned int width{static_cast<unsigned int>(size.width)};
             const unsigned int height{static_cast<unsigned int>(size.height)};
 
@@ -172,10 +173,10 @@ namespace pTK::Platform
         PTK_ASSERT(hints, "Unable to allocate memory for XSizeHints");
         long err;
         XGetWMNormalHints(App::Display(), m_window, hints, &err);
-        PTK_INFO("WindowHandleUnix: Trying to set new Window Limits, min: {}x{} & max: {}x{}", min.width, min.height,
-                 max.width, max.height);
-        PTK_INFO("WindowHandleUnix: Current Window Limits: min: {}x{} & max: {}x{}", hints->min_width,
-                 hints->min_height, hints->max_width, hints->max_height);
+        PTK_TRACE("WindowHandleUnix: Trying to set new Window Limits, min: {}x{} & max: {}x{}", min.width, min.height,
+                  max.width, max.height);
+        PTK_TRACE("WindowHandleUnix: Current Window Limits: min: {}x{} & max: {}x{}", hints->min_width,
+                  hints->min_height, hints->max_width, hints->max_height);
 
         constexpr int int_max = std::numeric_limits<int>::max();
 
@@ -186,7 +187,7 @@ namespace pTK::Platform
 
         if (hints->min_width != min_width || hints->min_height != min_height)
         {
-            PTK_INFO("WindowHandleUnix: Setting Min Size: {}x{}", min_width, min_height);
+            PTK_TRACE("WindowHandleUnix: Setting Min Size: {}x{}", min_width, min_height);
             hints->flags |= PMinSize;
             hints->min_width = min_width;
             hints->min_height = min_height;
@@ -199,7 +200,7 @@ namespace pTK::Platform
 
         if (hints->max_width != max_width || hints->max_height != max_height)
         {
-            PTK_INFO("WindowHandleUnix: Setting Max Size: {}x{}", max_width, max_height);
+            PTK_TRACE("WindowHandleUnix: Setting Max Size: {}x{}", max_width, max_height);
             hints->flags |= PMaxSize;
             hints->max_width = max_width;
             hints->max_height = max_height;
@@ -263,20 +264,8 @@ namespace pTK::Platform
 
     void WindowHandleUnix::notifyEvent()
     {
-        // notifyEvent is not thread safe, so m_window can already be destroyed.
-        if (m_window != x11::None)
-        {
-            Display* display{App::Display()};
-            const Atom nullAtom{XInternAtom(display, "NULL", False)};
-
-            XEvent event{ClientMessage};
-            event.xclient.window = m_window;
-            event.xclient.format = 32;
-            event.xclient.message_type = nullAtom;
-
-            XSendEvent(display, m_window, False, 0, &event);
-            XFlush(display);
-        }
+        // Wakes up the event loop locally, without sending anything to the X server.
+        App::Wakeup();
     }
 
     Point WindowHandleUnix::getPosition() const
@@ -354,21 +343,92 @@ namespace pTK::Platform
         handlePlatformEvent<PaintEvent>({{0, 0}, getSize()});
     }
 
-    static short GetMonitorRefreshRate() noexcept
+    static short GetScreenRefreshRate() noexcept
     {
         ::Display* display{App::Display()};
         ::Window root{RootWindow(display, 0)};
 
         XRRScreenConfiguration* conf{XRRGetScreenInfo(display, root)};
+        if (conf == nullptr)
+            return 0;
+
         short refreshRate{XRRConfigCurrentRate(conf)};
-        PTK_INFO("[x11] Found monitor refresh rate as {}Hz.", refreshRate);
+        XRRFreeScreenConfigInfo(conf);
+        return refreshRate;
+    }
+
+    static double GetModeRefreshRate(const XRRModeInfo& mode) noexcept
+    {
+        if ((mode.hTotal == 0) || (mode.vTotal == 0))
+            return 0.0;
+
+        double lines{static_cast<double>(mode.vTotal)};
+        if (mode.modeFlags & RR_DoubleScan)
+            lines *= 2.0;
+        if (mode.modeFlags & RR_Interlace)
+            lines /= 2.0;
+
+        return static_cast<double>(mode.dotClock) / (static_cast<double>(mode.hTotal) * lines);
+    }
+
+    // Refresh rate of the monitor (CRTC) that contains point, 0 if not found.
+    static double GetMonitorRefreshRate(const Point& point) noexcept
+    {
+        ::Display* display{App::Display()};
+        XRRScreenResources* resources{XRRGetScreenResourcesCurrent(display, App::Root())};
+        if (resources == nullptr)
+            return 0.0;
+
+        double refreshRate{0.0};
+        for (int i{0}; (i < resources->ncrtc) && (refreshRate <= 0.0); ++i)
+        {
+            XRRCrtcInfo* crtc{XRRGetCrtcInfo(display, resources, resources->crtcs[i])};
+            if (crtc == nullptr)
+                continue;
+
+            const bool inside{(crtc->mode != x11::None) && (point.x >= crtc->x) &&
+                              (point.x < crtc->x + static_cast<int>(crtc->width)) && (point.y >= crtc->y) &&
+                              (point.y < crtc->y + static_cast<int>(crtc->height))};
+            if (inside)
+            {
+                for (int j{0}; j < resources->nmode; ++j)
+                    if (resources->modes[j].id == crtc->mode)
+                        refreshRate = GetModeRefreshRate(resources->modes[j]);
+            }
+
+            XRRFreeCrtcInfo(crtc);
+        }
+
+        XRRFreeScreenResources(resources);
         return refreshRate;
     }
 
     std::size_t WindowHandleUnix::targetRefreshRate() const noexcept
     {
-        static const auto rate = static_cast<std::size_t>(GetMonitorRefreshRate());
-        return (rate > 0) ? rate : WindowHandle::targetRefreshRate();
+        return static_cast<std::size_t>(std::lround(refreshRate()));
+    }
+
+    double WindowHandleUnix::refreshRate() const noexcept
+    {
+        if (m_refreshRate <= 0.0)
+        {
+            // Monitor that contains the center of the window.
+            const Point pos{getPosition()};
+            const Size size{getSize()};
+            const Point center{pos.x + static_cast<Point::value_type>(size.width / 2),
+                               pos.y + static_cast<Point::value_type>(size.height / 2)};
+
+            double rate{GetMonitorRefreshRate(center)};
+            if (rate <= 0.0)
+                rate = static_cast<double>(GetScreenRefreshRate());
+            if (rate <= 0.0)
+                rate = static_cast<double>(WindowHandle::targetRefreshRate());
+
+            PTK_INFO("[x11] Found monitor refresh rate as {:.2f}Hz.", rate);
+            m_refreshRate = rate;
+        }
+
+        return m_refreshRate;
     }
 
     std::pair<unsigned long, unsigned char*> WindowHandleUnix::getWindowProperty(Atom property, Atom type) const
@@ -171,6 +171,14 @@ namespace pTK::Platform
         */
         [[nodiscard]] std::size_t targetRefreshRate() const noexcept override;
 
+        /** Function for retrieving the refresh rate of the monitor the window is on.
+
+            The rate is cached until the window is moved.
+
+            @return     refresh rate in Hz
+        */
+        [[nodiscard]] double refreshRate() const noexcept override;
+
         /** Function for retrieving the XWindow struct of the window.
 
             @return     XWindow struct
@@ -194,12 +202,14 @@ namespace pTK::Platform
 
         friend Size& WindowLastSize(WindowHandleUnix*);
         friend Point& WindowLastPos(WindowHandleUnix*);
+        friend double& WindowRefreshRate(WindowHandleUnix*);
 
     private:
         Size m_lastSize;
         Point m_lastPos{};
 
         Vec2f m_scale{1.0f, 1.0f};
+        mutable double m_refreshRate{0.0};
 
         ::Window m_window;
         Atom m_atomWmDeleteWindow;
@@ -26,7 +26,7 @@ namespace pTK::Platform::ContextFactoryImpl
 {
     static Size ScaleSize(const Size& size, const Vec2f& scale)
     {
-#ifdef PTK_DEBUG
+#ifdef PTK_ENABLE_LOG
         if (scale.x != scale.y)
             PTK_WARN("Context scale is not the same, x: {}, y: {}", static_cast<double>(scale.x),
                      static_cast<double>(scale.y));
@@ -67,7 +67,7 @@ namespace pTK::Platform::ContextFactoryImpl
             return MakeGLContext(window, size, scale);
 #endif
 
-#ifdef PTK_DEBUG
+#ifdef PTK_ENABLE_LOG
         if (info.backend == WindowInfo::Backend::Hardware)
             PTK_WARN("Could not create hardware context for platform: No hardware context available for platform.");
 #endif
@@ -67,7 +67,7 @@ namespace pTK::Platform
 
             // clear(Color{0xFFFFFFFF});
             setSize(size);
-            PTK_INFO("Sized GLContextWin to {}x{}", size.width, size.height);
+            PTK_TRACE("Sized GLContextWin to {}x{}", size.width, size.height);
         }
 #ifdef PTK_DEBUG
         else
@@ -82,7 +82,7 @@ namespace pTK::Platform
         return m_surface;
     }
 
-    void GLContextWin::swapBuffers()
+    void GLContextWin::swapBuffers(const DamageRegion&)
     {
         // PTK_INFO("swapBuffers");
         HDC dc = GetDC((HWND)m_hwnd);
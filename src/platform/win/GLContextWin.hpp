@@ -59,7 +59,7 @@ namespace pTK::Platform
         /** Function for swapping the buffers
 
         */
-        void swapBuffers() override;
+        void swapBuffers(const DamageRegion&) override;
 
     private:
         void createContext(const Size& size);
@@ -98,10 +98,10 @@ namespace pTK::Platform::MenuBarUtilWin
                     std::shared_ptr<Menu> rMenu = std::dynamic_pointer_cast<Menu>(*menuItemIt);
                     if (rMenu)
                         CreateMenuStructure(currentMenu, menus, rMenu, currentMenuId, keys);
-#ifdef PTK_DEBUG
+#ifdef PTK_ENABLE_LOG
                     else
                         PTK_WARN("Could not cast MenuItem to Menu");
-#endif // PTK_DEBUG
+#endif // PTK_ENABLE_LOG
                     break;
                 }
             }
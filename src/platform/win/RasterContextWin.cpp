@@ -48,11 +48,11 @@ namespace pTK::Platform
         m_bmpInfo->bmiHeader.biBitCount = 32;
         m_bmpInfo->bmiHeader.biCompression = BI_RGB;
 
-        PTK_INFO("Sized RasterContextWin to {}x{}", width, height);
+        PTK_TRACE("Sized RasterContextWin to {}x{}", width, height);
         return m_bmpInfo->bmiColors;
     }
 
-    void RasterContextWin::swapBuffers()
+    void RasterContextWin::swapBuffers(const DamageRegion&)
     {
         const auto size{getSize()};
         const auto width{static_cast<int>(size.width)};
@@ -57,7 +57,7 @@ namespace pTK::Platform
         /** Function to swap the buffers after drawing.
 
         */
-        void swapBuffers() override;
+        void swapBuffers(const DamageRegion&) override;
 
     private:
         BITMAPINFO* m_bmpInfo{nullptr};
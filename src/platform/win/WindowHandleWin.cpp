@@ -16,6 +16,7 @@
 #include "ptk/core/Exception.hpp"
 #include "ptk/events/KeyMap.hpp"
 #include "ptk/menu/NamedMenuItem.hpp"
+#include "ptk/util/UTF.hpp"
 
 // Windows Headers
 #include <Dwmapi.h>
@@ -91,7 +92,7 @@ namespace pTK::Platform
         HDC screen{GetDC(nullptr)};
         const float dpiX{static_cast<float>(::GetDeviceCaps(screen, LOGPIXELSX))};
         const float dpiY{static_cast<float>(::GetDeviceCaps(screen, LOGPIXELSY))};
-#ifdef PTK_DEBUG
+#ifdef PTK_ENABLE_LOG
         if (dpiX != dpiY)
         {
             PTK_WARN("DPI for x and y is not the same!");
@@ -325,14 +326,21 @@ namespace pTK::Platform
 
     void WindowHandleWin::setLimits([[maybe_unused]] const Size& min, [[maybe_unused]] const Size& max)
     {
-        PTK_INFO("Updating Window limits to: min: {}x{} max: {}x{}", min.width, min.height, max.width, max.height);
+        PTK_TRACE("Updating Window limits to: min: {}x{} max: {}x{}", min.width, min.height, max.width, max.height);
         RECT rect{};
         ::GetWindowRect(m_hwnd, &rect);
         ::MoveWindow(m_hwnd, rect.left, rect.top, rect.right - rect.left, rect.bottom - rect.top, FALSE);
     }
 
-    static int GetMonitorRefreshRate() noexcept
+    static int GetMonitorRefreshRate(HMONITOR monitor) noexcept
     {
+        // Name of the display device of the monitor.
+        MONITORINFOEXW info{};
+        info.cbSize = sizeof(MONITORINFOEXW);
+        const wchar_t* device{nullptr};
+        if ((monitor != nullptr) && ::GetMonitorInfoW(monitor, &info))
+            device = info.szDevice;
+
         // display device structure .
         DEVMODEW deviceMode{};
         ZeroMemory(&deviceMode, sizeof(deviceMode));
@@ -340,7 +348,7 @@ namespace pTK::Platform
         deviceMode.dmDriverExtra = 0;
 
         // Get the information.
-        if (::EnumDisplaySettingsW(nullptr, ENUM_CURRENT_SETTINGS, &deviceMode))
+        if (::EnumDisplaySettingsW(device, ENUM_CURRENT_SETTINGS, &deviceMode))
             return deviceMode.dmDisplayFrequency;
 
         return -1;
@@ -348,8 +356,16 @@ namespace pTK::Platform
 
     std::size_t WindowHandleWin::targetRefreshRate() const noexcept
     {
-        static std::size_t rate = GetMonitorRefreshRate();
-        return (rate > 0) ? rate : WindowHandle::targetRefreshRate();
+        // The rate is only queried again when the window is on another monitor.
+        HMONITOR monitor{::MonitorFromWindow(m_hwnd, MONITOR_DEFAULTTONEAREST)};
+        if ((monitor != m_monitor) || (m_refreshRate == 0))
+        {
+            const int rate{GetMonitorRefreshRate(monitor)};
+            m_refreshRate = (rate > 1) ? static_cast<std::size_t>(rate) : WindowHandle::targetRefreshRate();
+            m_monitor = monitor;
+        }
+
+        return m_refreshRate;
     }
 
     bool WindowHandleWin::minimize()
@@ -576,11 +592,12 @@ namespace pTK::Platform
         handle->handlePlatformEvent<KeyEvent>(evt);
     }
 
-    static void HandleCharInput(WindowHandleWin* handle, WPARAM wParam, LPARAM UNUSED(lParam))
+    static void HandleCharInput(WindowHandleWin::Data* data, WPARAM wParam, LPARAM UNUSED(lParam))
     {
-        PTK_ASSERT(handle, "WindowHandleWin pointer is undefined");
+        PTK_ASSERT(data, "WindowHandleWin::Data pointer is undefined");
+        WindowHandleWin* handle{data->window};
 
-        uint32_t data{0};
+        uint32_t unit{0};
 
         switch (wParam)
         {
@@ -597,17 +614,27 @@ namespace pTK::Platform
             default:
             {
                 // Displayable character.
-                data = static_cast<uint32_t>(wParam);
+                unit = static_cast<uint32_t>(wParam);
                 break;
             }
         }
 
-        if (data > 0)
+        // Characters outside the BMP are sent as two WM_CHAR (surrogate pair).
+        if ((unit >= 0xD800) && (unit <= 0xDBFF))
+        {
+            data->highSurrogate = static_cast<char16_t>(unit);
+            return;
+        }
+
+        if (unit > 0)
         {
-            pTK::InputEvent::data_cont arr(new pTK::InputEvent::data_type[1]);
-            arr[0] = data;
+            const char16_t units[2]{data->highSurrogate, static_cast<char16_t>(unit)};
+            const std::size_t first{(data->highSurrogate != 0) ? 0u : 1u};
+            data->highSurrogate = 0;
 
-            InputEvent evt{arr, 1, Text::Encoding::UTF16};
+            InputEvent::data_type codepoints[2];
+            const std::size_t count{UTF::DecodeUTF16(units + first, 2 - first, codepoints, 2).written};
+            InputEvent evt{codepoints, count};
             handle->handlePlatformEvent<InputEvent>(evt);
         }
     }
@@ -679,7 +706,7 @@ namespace pTK::Platform
             }
             case WM_CHAR:
             {
-                HandleCharInput(handle, wParam, lParam);
+                HandleCharInput(data, wParam, lParam);
                 break;
             }
             case WM_SYSKEYDOWN:
@@ -207,6 +207,7 @@ namespace pTK::Platform
             bool ignoreSize{false};
             bool hasMenu{false};
             DWORD style{WS_OVERLAPPEDWINDOW};
+            char16_t highSurrogate{0}; // First half of a surrogate pair from WM_CHAR.
         };
 
     private:
@@ -214,6 +215,8 @@ namespace pTK::Platform
 
     private:
         HWND m_hwnd;
+        mutable HMONITOR m_monitor{nullptr};
+        mutable std::size_t m_refreshRate{0};
         Vec2f m_scale{};
         HACCEL m_accelTable{nullptr};
         Data m_data{};
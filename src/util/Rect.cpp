@@ -0,0 +1,99 @@
+//
+//  util/Rect.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// pTK Headers
+#include "ptk/util/Rect.hpp"
+
+// C++ Headers
+#include <algorithm>
+#include <limits>
+
+namespace pTK
+{
+    static Point::value_type AddEdge(Point::value_type start, Size::value_type length) noexcept
+    {
+        // Size::value_type can be larger than Point::value_type, clamp instead of overflowing.
+        constexpr int64_t max{std::numeric_limits<Point::value_type>::max()};
+        const int64_t edge{static_cast<int64_t>(start) + static_cast<int64_t>(length)};
+        return static_cast<Point::value_type>((edge > max) ? max : edge);
+    }
+
+    static Rect FromEdges(Point::value_type left, Point::value_type top, Point::value_type right,
+                          Point::value_type bottom) noexcept
+    {
+        if ((right <= left) || (bottom <= top))
+            return {};
+
+        const auto width{static_cast<int64_t>(right) - static_cast<int64_t>(left)};
+        const auto height{static_cast<int64_t>(bottom) - static_cast<int64_t>(top)};
+        return {{left, top}, {static_cast<Size::value_type>(width), static_cast<Size::value_type>(height)}};
+    }
+
+    Point::value_type Rect::right() const noexcept
+    {
+        return AddEdge(pos.x, size.width);
+    }
+
+    Point::value_type Rect::bottom() const noexcept
+    {
+        return AddEdge(pos.y, size.height);
+    }
+
+    bool Rect::contains(const Point& point) const noexcept
+    {
+        return (point.x >= pos.x) && (point.x < right()) && (point.y >= pos.y) && (point.y < bottom());
+    }
+
+    bool Rect::contains(const Rect& other) const noexcept
+    {
+        if (isEmpty() || other.isEmpty())
+            return false;
+
+        return (other.pos.x >= pos.x) && (other.right() <= right()) && (other.pos.y >= pos.y) &&
+               (other.bottom() <= bottom());
+    }
+
+    bool Rect::intersects(const Rect& other) const noexcept
+    {
+        if (isEmpty() || other.isEmpty())
+            return false;
+
+        return (pos.x < other.right()) && (other.pos.x < right()) && (pos.y < other.bottom()) &&
+               (other.pos.y < bottom());
+    }
+
+    Rect Rect::intersected(const Rect& other) const noexcept
+    {
+        if (!intersects(other))
+            return {};
+
+        return FromEdges(std::max(pos.x, other.pos.x), std::max(pos.y, other.pos.y), std::min(right(), other.right()),
+                         std::min(bottom(), other.bottom()));
+    }
+
+    Rect Rect::united(const Rect& other) const noexcept
+    {
+        if (other.isEmpty())
+            return *this;
+        if (isEmpty())
+            return other;
+
+        return FromEdges(std::min(pos.x, other.pos.x), std::min(pos.y, other.pos.y), std::max(right(), other.right()),
+                         std::max(bottom(), other.bottom()));
+    }
+
+    // Comparison operators.
+    bool operator==(const Rect& lhs, const Rect& rhs)
+    {
+        return ((lhs.pos == rhs.pos) && (lhs.size == rhs.size));
+    }
+
+    bool operator!=(const Rect& lhs, const Rect& rhs)
+    {
+        return !(lhs == rhs);
+    }
+} // namespace pTK
@@ -7,13 +7,17 @@
 
 // pTK Headers
 #include "ptk/widgets/BoxLayout.hpp"
+#include "ptk/core/Profiler.hpp"
 #include "ptk/util/Math.hpp"
 
 // C++ Headers
+#include <algorithm>
 #include <array>
 #include <functional>
+#include <numeric>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace pTK
 {
@@ -118,40 +122,93 @@ namespace pTK
         return spaces;
     }
 
+    // Distributes space evenly among items without exceeding the capacity of any item.
+    // Items with the least capacity are filled first (water-filling), the remainder of an
+    // uneven division is given to the first items that still have capacity left.
+    // Returns the space that could not be distributed.
+    static Size::value_type DistributeSpace(Size::value_type space, const std::vector<Size::value_type>& capacity,
+                                            std::vector<Size::value_type>& added)
+    {
+        const std::size_t count{capacity.size()};
+        added.assign(count, 0);
+        if ((space == 0) || (count == 0))
+            return space;
+
+        std::vector<std::size_t> order(count);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&capacity](std::size_t lhs, std::size_t rhs) {
+            return capacity[lhs] < capacity[rhs];
+        });
+
+        // Items that can be filled completely.
+        std::size_t k{0};
+        for (; k < count; ++k)
+        {
+            const std::size_t index{order[k]};
+            const Size::value_type share{static_cast<Size::value_type>(space / (count - k))};
+            if (capacity[index] > share)
+                break;
+
+            added[index] = capacity[index];
+            space -= capacity[index];
+        }
+
+        if (k == count)
+            return space;
+
+        // Remaining items can all take an equal share (and one more).
+        const std::size_t remaining{count - k};
+        const Size::value_type share{static_cast<Size::value_type>(space / remaining)};
+        std::size_t extra{space % remaining};
+        std::vector<bool> open(count, false);
+        for (std::size_t j{k}; j < count; ++j)
+        {
+            added[order[j]] = share;
+            open[order[j]] = true;
+        }
+        space -= static_cast<Size::value_type>(share * remaining);
+
+        for (std::size_t i{0}; (i < count) && (extra > 0); ++i)
+        {
+            if (open[i])
+            {
+                ++added[i];
+                --space;
+                --extra;
+            }
+        }
+
+        return space;
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
     //                                Vertical                                   //
     ///////////////////////////////////////////////////////////////////////////////
 
     namespace VerticalLayout
     {
-        static Size ContentMinSize(const BoxLayout::const_iterator& start, const BoxLayout::const_iterator& end)
+        static Size ContentMinSize(const std::vector<Size>& sizes)
         {
-            Size contMinSize{Size::Min};
-            for (auto it{start}; it != end; ++it)
+            Size contSize{Size::Min};
+            for (const Size& size : sizes)
             {
-                const Limits limits{(*it)->getLimitsWithSizePolicy()};
-                const Size minSize{(*it)->calcOuterFromSize(limits.min)};
-
-                contMinSize.height = Math::AddWithoutOverflow(contMinSize.height, minSize.height);
-                contMinSize.width = (minSize.width > contMinSize.width) ? minSize.width : contMinSize.width;
+                contSize.height = Math::AddWithoutOverflow(contSize.height, size.height);
+                contSize.width = (size.width > contSize.width) ? size.width : contSize.width;
             }
 
-            return contMinSize;
+            return contSize;
         }
 
-        static Size ContentMaxSize(const BoxLayout::const_iterator& start, const BoxLayout::const_iterator& end)
+        static Size ContentMaxSize(const std::vector<Size>& sizes)
         {
-            Size contMaxSize{Size::Max};
-            for (auto it{start}; it != end; ++it)
+            Size contSize{Size::Max};
+            for (const Size& size : sizes)
             {
-                const Limits limits{(*it)->getLimitsWithSizePolicy()};
-                const Size maxSize{(*it)->calcOuterFromSize(limits.max)};
-
-                contMaxSize.height = Math::AddWithoutOverflow(contMaxSize.height, maxSize.height);
-                contMaxSize.width = (maxSize.width > contMaxSize.width) ? maxSize.width : contMaxSize.width;
+                contSize.height = Math::AddWithoutOverflow(contSize.height, size.height);
+                contSize.width = (size.width > contSize.width) ? size.width : contSize.width;
             }
 
-            return contMaxSize;
+            return contSize;
         }
 
         template <typename Iter>
@@ -188,85 +245,30 @@ namespace pTK
             }
         }
 
-        static void RefitContent(Size boxSize, Point boxPos, BoxLayout::Direction direction, const BoxLayout& box)
+        static void RefitContent(Size boxSize, Point boxPos, BoxLayout::Direction direction, const BoxLayout& box,
+                                 const std::vector<Size>& minSizes, const std::vector<Size>& maxSizes,
+                                 const Size& contentMin)
         {
             const BoxLayout::size_type childrenCount{box.count()};
-            std::vector<Size> data(childrenCount);
 
-            // Initialize sizes.
-            std::size_t i{0};
-            LoopBasedOnDirection(box, direction, [boxSize, &data, &i](auto it) {
-                const Limits limits = (*it)->getLimitsWithSizePolicy();
-                data.at(i) = (*it)->calcOuterFromSize(limits.min);
-
-                const Size::value_type maxWidth{(*it)->calcOuterFromSize(limits.max).width};
-                data.at(i).width = (boxSize.width > maxWidth) ? maxWidth : boxSize.width;
-
-                ++i;
-            });
-
-            // Expand children to its max sizes possible.
-            const Size::value_type heightLeft = boxSize.height - ContentMinSize(box.cbegin(), box.cend()).height;
-            Size::value_type totalEachLeft{heightLeft};
-
-            // Distribute heightLeft.
-            // Need to fix this some time.
-            // TODO: it takes many iteration before the height is distributed, especially if only 1 can grow.
-            Size::value_type lastEachLeft = totalEachLeft;
-            while (totalEachLeft > 0)
+            // Initialize sizes (in container order).
+            std::vector<Size> data(childrenCount);
+            std::vector<Size::value_type> capacity(childrenCount);
+            for (std::size_t i{0}; i < childrenCount; ++i)
             {
-                Size::value_type eachAdd{static_cast<Size::value_type>(
-                    std::floor(static_cast<float>(totalEachLeft) / static_cast<float>(childrenCount)))};
-                eachAdd = (totalEachLeft < static_cast<Size::value_type>(childrenCount)) ? 1 : eachAdd;
-                bool done{true};
-
-                i = 0;
-                for (const auto& child : box)
-                {
-                    const Limits limits = child->getLimitsWithSizePolicy();
-
-                    // Max - Min
-                    const Size::value_type maxHeight = child->calcOuterFromSize(limits.max).height;
-                    const Size::value_type delta{maxHeight - data.at(i).height};
-
-                    if (delta > 0)
-                    {
-                        if (eachAdd > delta)
-                        {
-                            data.at(i).height += delta;
-                            totalEachLeft -= (delta);
-                            done = false;
-                        }
-                        else
-                        {
-                            data.at(i).height += eachAdd;
-                            totalEachLeft -= (eachAdd);
-                            done = false;
-                        }
-                    }
-
-                    if (totalEachLeft == 0)
-                    {
-                        done = true;
-                        break;
-                    }
-
-                    ++i;
-                }
-
-                // Check if the total was reduced.
-                // if not break as nothing was added (same will happen next iteration).
-                if (totalEachLeft == lastEachLeft)
-                    break;
-
-                lastEachLeft = totalEachLeft;
-
-                // We cannot add more to the widgets.
-                if ((done) || (eachAdd == 0))
-                    break;
+                data[i] = minSizes[i];
+                data[i].width = (boxSize.width > maxSizes[i].width) ? maxSizes[i].width : boxSize.width;
+                capacity[i] = (maxSizes[i].height > minSizes[i].height) ? maxSizes[i].height - minSizes[i].height : 0;
             }
 
-            // TODO: Fix if we break in while loop (size left unused).
+            // Expand children to its max sizes possible.
+            const Size::value_type heightLeft{(boxSize.height > contentMin.height) ? boxSize.height - contentMin.height : 0};
+            std::vector<Size::value_type> added{};
+            const Size::value_type totalEachLeft{DistributeSpace(heightLeft, capacity, added)};
+            for (std::size_t i{0}; i < childrenCount; ++i)
+                data[i].height += added[i];
+
+            // Size left unused is used for spacing based on alignment.
             using vec_type = std::vector<Size::value_type>;
             const auto fInfo = [](vec_type& spaces, BoxLayout::const_iterator start, BoxLayout::const_iterator end) {
                 CalcSpaceInfo(spaces, std::move(start), std::move(end));
@@ -278,10 +280,12 @@ namespace pTK
             const std::vector<Size::value_type> spaces{CalcSpaces(totalEachLeft, box, fInfo, rInfo)};
 
             // Update size and position for widgets.
-            i = 0;
-            LoopBasedOnDirection(box, direction, [&boxPos, boxSize, &data, &spaces, &i](auto it) {
+            const bool forward{IsForwardOrdering(direction)};
+            std::size_t i{0};
+            LoopBasedOnDirection(box, direction, [&](auto it) {
                 constexpr int int_max = std::numeric_limits<int>::max();
                 auto& child = (*it);
+                Size& cSize{data.at((forward) ? i : (childrenCount - 1 - i))};
 
                 // Margin.
                 Margin cMargin{child->getMargin()};
@@ -289,16 +293,16 @@ namespace pTK
                 cMargin.bottom = (cMargin.bottom > static_cast<Margin::value_type>(int_max)) ? int_max : cMargin.bottom;
 
                 // New Size.
-                data.at(i).height -= static_cast<Size::value_type>(cMargin.top + cMargin.bottom);
-                data.at(i).width -= static_cast<Size::value_type>(cMargin.left + cMargin.right);
-                if (child->getSize() != data.at(i))
-                    child->setSize(data.at(i));
+                cSize.height -= static_cast<Size::value_type>(cMargin.top + cMargin.bottom);
+                cSize.width -= static_cast<Size::value_type>(cMargin.left + cMargin.right);
+                if (child->getSize() != cSize)
+                    child->setSize(cSize);
 
                 // Position.
                 boxPos.y += static_cast<Point::value_type>(cMargin.top) + static_cast<Point::value_type>(spaces.at(i));
-                child->setPosHint(Point(boxPos.x + AlignChildH(child.get(), boxSize, data.at(i)), boxPos.y));
+                child->setPosHint(Point(boxPos.x + AlignChildH(child.get(), boxSize, cSize), boxPos.y));
                 boxPos.y +=
-                    static_cast<Point::value_type>(data.at(i).height) + static_cast<Point::value_type>(cMargin.bottom);
+                    static_cast<Point::value_type>(cSize.height) + static_cast<Point::value_type>(cMargin.bottom);
 
                 ++i;
             });
@@ -348,34 +352,28 @@ namespace pTK
 
     namespace HorizontalLayout
     {
-        static Size ContentMinSize(const BoxLayout::const_iterator& start, const BoxLayout::const_iterator& end)
+        static Size ContentMinSize(const std::vector<Size>& sizes)
         {
-            Size contMinSize{Size::Min};
-            for (auto it{start}; it != end; ++it)
+            Size contSize{Size::Min};
+            for (const Size& size : sizes)
             {
-                const Limits limits{(*it)->getLimitsWithSizePolicy()};
-                const Size minSize{(*it)->calcOuterFromSize(limits.min)};
-
-                contMinSize.height = (minSize.height > contMinSize.height) ? minSize.height : contMinSize.height;
-                contMinSize.width = Math::AddWithoutOverflow(contMinSize.width, minSize.width);
+                contSize.width = Math::AddWithoutOverflow(contSize.width, size.width);
+                contSize.height = (size.height > contSize.height) ? size.height : contSize.height;
             }
 
-            return contMinSize;
+            return contSize;
         }
 
-        static Size ContentMaxSize(const BoxLayout::const_iterator& start, const BoxLayout::const_iterator& end)
+        static Size ContentMaxSize(const std::vector<Size>& sizes)
         {
-            Size contMaxSize{Size::Max};
-            for (auto it{start}; it != end; ++it)
+            Size contSize{Size::Max};
+            for (const Size& size : sizes)
             {
-                const Limits limits{(*it)->getLimitsWithSizePolicy()};
-                const Size maxSize{(*it)->calcOuterFromSize(limits.max)};
-
-                contMaxSize.height = (maxSize.height > contMaxSize.height) ? maxSize.height : contMaxSize.height;
-                contMaxSize.width = Math::AddWithoutOverflow(contMaxSize.width, maxSize.width);
+                contSize.width = Math::AddWithoutOverflow(contSize.width, size.width);
+                contSize.height = (size.height > contSize.height) ? size.height : contSize.height;
             }
 
-            return contMaxSize;
+            return contSize;
         }
 
         template <typename Iter>
@@ -412,85 +410,30 @@ namespace pTK
             }
         }
 
-        static void RefitContent(Size boxSize, Point boxPos, BoxLayout::Direction direction, const BoxLayout& box)
+        static void RefitContent(Size boxSize, Point boxPos, BoxLayout::Direction direction, const BoxLayout& box,
+                                 const std::vector<Size>& minSizes, const std::vector<Size>& maxSizes,
+                                 const Size& contentMin)
         {
             const BoxLayout::size_type childrenCount{box.count()};
-            std::vector<Size> data(childrenCount);
 
-            // Initialize sizes.
-            std::size_t i{0};
-            LoopBasedOnDirection(box, direction, [boxSize, &data, &i](auto it) {
-                const Limits limits = (*it)->getLimitsWithSizePolicy();
-                data.at(i) = (*it)->calcOuterFromSize(limits.min);
-
-                const Size::value_type maxHeight{(*it)->calcOuterFromSize(limits.max).height};
-                data.at(i).height = (boxSize.height > maxHeight) ? maxHeight : boxSize.height;
-
-                ++i;
-            });
-
-            // Expand children to its max sizes possible.
-            const Size::value_type widthLeft{boxSize.width - ContentMinSize(box.cbegin(), box.cend()).width};
-            Size::value_type totalEachLeft{widthLeft};
-
-            // Distribute heightLeft.
-            // Need to fix this some time.
-            // TODO: it takes many iteration before the height is distributed, especially if only 1 can grow.
-            Size::value_type lastEachLeft = totalEachLeft;
-            while (totalEachLeft > 0)
+            // Initialize sizes (in container order).
+            std::vector<Size> data(childrenCount);
+            std::vector<Size::value_type> capacity(childrenCount);
+            for (std::size_t i{0}; i < childrenCount; ++i)
             {
-                Size::value_type eachAdd{static_cast<Size::value_type>(
-                    std::floor(static_cast<float>(totalEachLeft) / static_cast<float>(childrenCount)))};
-                eachAdd = (totalEachLeft < static_cast<Size::value_type>(childrenCount)) ? 1 : eachAdd;
-                bool done{true};
-
-                i = 0;
-                for (const auto& child : box)
-                {
-                    const Limits limits = child->getLimitsWithSizePolicy();
-
-                    // Max - Min
-                    const Size::value_type maxWidth = child->calcOuterFromSize(limits.max).width;
-                    const Size::value_type delta{maxWidth - data.at(i).width};
-
-                    if (delta > 0)
-                    {
-                        if (eachAdd > delta)
-                        {
-                            data.at(i).width += delta;
-                            totalEachLeft -= (delta);
-                            done = false;
-                        }
-                        else
-                        {
-                            data.at(i).width += eachAdd;
-                            totalEachLeft -= (eachAdd);
-                            done = false;
-                        }
-                    }
-
-                    if (totalEachLeft == 0)
-                    {
-                        done = true;
-                        break;
-                    }
-
-                    ++i;
-                }
-
-                // Check if the total was reduced.
-                // if not break as nothing was added (same will happen next iteration).
-                if (totalEachLeft == lastEachLeft)
-                    break;
-
-                lastEachLeft = totalEachLeft;
-
-                // We cannot add more to the widgets.
-                if ((done) || (eachAdd == 0))
-                    break;
+                data[i] = minSizes[i];
+                data[i].height = (boxSize.height > maxSizes[i].height) ? maxSizes[i].height : boxSize.height;
+                capacity[i] = (maxSizes[i].width > minSizes[i].width) ? maxSizes[i].width - minSizes[i].width : 0;
             }
 
-            // TODO: Fix if we break in while loop (size left unused).
+            // Expand children to its max sizes possible.
+            const Size::value_type widthLeft{(boxSize.width > contentMin.width) ? boxSize.width - contentMin.width : 0};
+            std::vector<Size::value_type> added{};
+            const Size::value_type totalEachLeft{DistributeSpace(widthLeft, capacity, added)};
+            for (std::size_t i{0}; i < childrenCount; ++i)
+                data[i].width += added[i];
+
+            // Size left unused is used for spacing based on alignment.
             using vec_type = std::vector<Size::value_type>;
             const auto fInfo = [](vec_type& spaces, BoxLayout::const_iterator start, BoxLayout::const_iterator end) {
                 CalcSpaceInfo(spaces, std::move(start), std::move(end));
@@ -502,10 +445,12 @@ namespace pTK
             const std::vector<Size::value_type> spaces{CalcSpaces(totalEachLeft, box, fInfo, rInfo)};
 
             // Update size and position for widgets.
-            i = 0;
-            LoopBasedOnDirection(box, direction, [&boxPos, boxSize, &data, &spaces, &i](auto it) {
+            const bool forward{IsForwardOrdering(direction)};
+            std::size_t i{0};
+            LoopBasedOnDirection(box, direction, [&](auto it) {
                 constexpr int int_max = std::numeric_limits<int>::max();
                 auto& child = (*it);
+                Size& cSize{data.at((forward) ? i : (childrenCount - 1 - i))};
 
                 // Margin.
                 Margin cMargin{child->getMargin()};
@@ -513,16 +458,16 @@ namespace pTK
                 cMargin.right = (cMargin.right > static_cast<Margin::value_type>(int_max)) ? int_max : cMargin.right;
 
                 // New Size.
-                data.at(i).height -= static_cast<Size::value_type>(cMargin.top + cMargin.bottom);
-                data.at(i).width -= static_cast<Size::value_type>(cMargin.left + cMargin.right);
-                if (child->getSize() != data.at(i))
-                    child->setSize(data.at(i));
+                cSize.height -= static_cast<Size::value_type>(cMargin.top + cMargin.bottom);
+                cSize.width -= static_cast<Size::value_type>(cMargin.left + cMargin.right);
+                if (child->getSize() != cSize)
+                    child->setSize(cSize);
 
                 // Position.
                 boxPos.x += static_cast<Point::value_type>(cMargin.left) + static_cast<Point::value_type>(spaces.at(i));
-                child->setPosHint(Point(boxPos.x, boxPos.y + AlignChildV(child.get(), boxSize, data.at(i))));
+                child->setPosHint(Point(boxPos.x, boxPos.y + AlignChildV(child.get(), boxSize, cSize)));
                 boxPos.x +=
-                    static_cast<Point::value_type>(data.at(i).width) + static_cast<Point::value_type>(cMargin.right);
+                    static_cast<Point::value_type>(cSize.width) + static_cast<Point::value_type>(cMargin.right);
 
                 ++i;
             });
@@ -570,23 +515,48 @@ namespace pTK
     //                               BoxLayout                                   //
     ///////////////////////////////////////////////////////////////////////////////
 
+    static SpatialIndex::Type IndexTypeFor(BoxLayout::Direction direction) noexcept
+    {
+        // Children are ordered along a single axis.
+        return (IsHorizontalOrdering(direction)) ? SpatialIndex::Type::Horizontal : SpatialIndex::Type::Vertical;
+    }
+
     BoxLayout::BoxLayout(Direction direction)
         : WidgetContainer(),
           m_direction{direction}
     {
         setMaxSize(Size::Max);
+        setSpatialIndexType(IndexTypeFor(direction));
     }
 
     void BoxLayout::refitContent(Size size, Point pos)
     {
+        PTK_PROFILE_ZONE("BoxLayout::refitContent");
+
         const size_type childrenCount{count()};
-        if (childrenCount == 0)
+        if ((childrenCount == 0) || m_refitting)
             return;
 
-        if (IsVerticalOrdering(direction()))
-            VerticalLayout::RefitContent(size, pos, direction(), *this);
-        else
-            HorizontalLayout::RefitContent(size, pos, direction(), *this);
+        // Children will call onChildUpdate when resized and moved, only the limits are updated.
+        m_refitting = true;
+        updateLimitsCache();
+
+        // Children might change their limits when resized (such as wrapped text), the content
+        // is then refitted with the new limits. The passes are limited, to not loop forever on
+        // limits that never settle.
+        for (std::size_t pass{0}; pass < s_maxRefitPasses; ++pass)
+        {
+            if (IsVerticalOrdering(direction()))
+                VerticalLayout::RefitContent(size, pos, direction(), *this, m_minSizes, m_maxSizes, m_contentMin);
+            else
+                HorizontalLayout::RefitContent(size, pos, direction(), *this, m_minSizes, m_maxSizes,
+                                               m_contentMin);
+
+            if (!updateLimitsCache())
+                break;
+        }
+
+        m_refitting = false;
     }
 
     void BoxLayout::expandOnAdd(Size size, Point pos)
@@ -596,10 +566,69 @@ namespace pTK
         layoutSize.width = (size.width > layoutSize.width) ? size.width : layoutSize.width;
         setSize(layoutSize); // this will generate a Resize event.
 
+        m_refitting = true;
         if (IsVerticalOrdering(direction()))
             VerticalLayout::ExpandOnAdd(size, pos, direction(), *this);
         else
             HorizontalLayout::ExpandOnAdd(size, pos, direction(), *this);
+        m_refitting = false;
+    }
+
+    void BoxLayout::invalidateChildLimits(size_type index)
+    {
+        m_outdatedChildren.push_back(index);
+    }
+
+    void BoxLayout::invalidateChildLimits() noexcept
+    {
+        m_cachedChildren.clear();
+        m_outdatedChildren.clear();
+    }
+
+    bool BoxLayout::updateLimitsCache() const
+    {
+        const size_type childrenCount{count()};
+        bool changed{!m_contentValid || (m_cachedChildren.size() != childrenCount)};
+
+        m_cachedChildren.resize(childrenCount, nullptr);
+        m_minSizes.resize(childrenCount);
+        m_maxSizes.resize(childrenCount);
+
+        for (size_type index : m_outdatedChildren)
+            if (index < childrenCount)
+                m_cachedChildren[index] = nullptr;
+        m_outdatedChildren.clear();
+
+        size_type i{0};
+        for (const auto& child : *this)
+        {
+            if (m_cachedChildren[i] != child.get())
+            {
+                // Outdated entries are only a change if the limits differ.
+                const Limits limits{child->getLimitsWithSizePolicy()};
+                const Size min{child->calcOuterFromSize(limits.min)};
+                const Size max{child->calcOuterFromSize(limits.max)};
+                if ((m_cachedChildren[i] != nullptr) || (min != m_minSizes[i]) || (max != m_maxSizes[i]))
+                    changed = true;
+
+                m_minSizes[i] = min;
+                m_maxSizes[i] = max;
+                m_cachedChildren[i] = child.get();
+            }
+            ++i;
+        }
+
+        if (changed)
+        {
+            const bool vertical{IsVerticalOrdering(direction())};
+            m_contentMin = (vertical) ? VerticalLayout::ContentMinSize(m_minSizes)
+                                      : HorizontalLayout::ContentMinSize(m_minSizes);
+            m_contentMax = (vertical) ? VerticalLayout::ContentMaxSize(m_maxSizes)
+                                      : HorizontalLayout::ContentMaxSize(m_maxSizes);
+            m_contentValid = true;
+        }
+
+        return changed;
     }
 
     bool BoxLayout::onLayoutRequest(Direction)
@@ -612,16 +641,23 @@ namespace pTK
         refitContent(getSize(), getPosition());
     }
 
+    template <typename Iter>
+    static void DrawVisible(Iter first, Iter last, Canvas* canvas)
+    {
+        // Children outside of the current clip (damaged region) are skipped.
+        for (auto it{first}; it != last; ++it)
+            if (!canvas->quickReject((*it)->getPosition(), (*it)->getSize()))
+                (*it)->drawCached(canvas);
+    }
+
     static void ForwardDraw(BoxLayout* box, Canvas* canvas)
     {
-        for (auto it{box->begin()}; it != box->end(); ++it)
-            (*it)->onDraw(canvas);
+        DrawVisible(box->begin(), box->end(), canvas);
     }
 
     static void ReverseDraw(BoxLayout* box, Canvas* canvas)
     {
-        for (auto it{box->rbegin()}; it != box->rend(); ++it)
-            (*it)->onDraw(canvas);
+        DrawVisible(box->rbegin(), box->rend(), canvas);
     }
 
     void BoxLayout::drawChildrenWithDir(Canvas* canvas)
@@ -642,7 +678,7 @@ namespace pTK
     {
         if (onLayoutRequest(direction))
         {
-            m_direction = direction;
+            updateDirection(direction);
             onLayoutChange();
             triggerEvent<Direction>(direction);
         }
@@ -651,9 +687,23 @@ namespace pTK
     void BoxLayout::updateDirection(Direction direction)
     {
         m_direction = direction;
+        m_contentValid = false;
+        setSpatialIndexType(IndexTypeFor(direction));
     }
 
     void BoxLayout::onAdd(const value_type&)
+    {
+        fitChildren();
+    }
+
+    void BoxLayout::onBatchEnd()
+    {
+        // Children might have been added, removed or updated.
+        invalidateChildLimits();
+        fitChildren();
+    }
+
+    void BoxLayout::fitChildren()
     {
         const Size minLayoutSize{calcMinSize()};
         setMinSize(minLayoutSize);
@@ -678,29 +728,27 @@ namespace pTK
         refitContent(getSize(), getPosition());
     }
 
-    void BoxLayout::onChildUpdate(size_type)
+    void BoxLayout::onChildUpdate(size_type index)
     {
+        invalidateChildLimits(index);
         refitContent(getSize(), getPosition());
     }
 
     void BoxLayout::onSizeChange(const Size& size)
     {
         refitContent(size, getPosition());
+        reportDamage();
     }
 
     Size BoxLayout::calcMinSize() const
     {
-        if (IsVerticalOrdering(direction()))
-            return calcOuterFromSize(VerticalLayout::ContentMinSize(cbegin(), cend()));
-
-        return calcOuterFromSize(HorizontalLayout::ContentMinSize(cbegin(), cend()));
+        updateLimitsCache();
+        return calcOuterFromSize(m_contentMin);
     }
 
     Size BoxLayout::calcMaxSize() const
     {
-        if (IsVerticalOrdering(direction()))
-            return calcOuterFromSize(VerticalLayout::ContentMaxSize(cbegin(), cend()));
-
-        return calcOuterFromSize(HorizontalLayout::ContentMaxSize(cbegin(), cend()));
+        updateLimitsCache();
+        return calcOuterFromSize(m_contentMax);
     }
 } // namespace pTK
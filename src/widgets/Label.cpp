@@ -20,13 +20,14 @@ namespace pTK
     void Label::onDraw(Canvas* canvas)
     {
         const Vec2f pos{static_cast<float>(getPosition().x), static_cast<float>(getPosition().y)};
-        const Text::StrData data{m_text.c_str(), m_text.size(), Text::Encoding::UTF8};
-        canvas->drawTextLine(data, getColor(), pos, &skFont(), getOutlineThickness(), getOutlineColor());
+        canvas->drawShapedText(shapedText(), getColor(), pos, getOutlineThickness(), getOutlineColor());
     }
 
     void Label::onTextUpdate()
     {
-        Vec2f bounds{getBoundsFromStr(m_text)};
+        updateShapedText(m_text);
+
+        Vec2f bounds{shapedText().bounds()};
         bounds.x = Math::ceilf(bounds.x);
         bounds.y = Math::ceilf(bounds.y);
         const Size size{Size::MakeNarrow(bounds.x, bounds.y)};
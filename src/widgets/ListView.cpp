@@ -0,0 +1,229 @@
+//
+//  widgets/ListView.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// pTK Headers
+#include "ptk/widgets/ListView.hpp"
+
+// C++ Headers
+#include <algorithm>
+
+namespace pTK
+{
+    ListView::ListView()
+        : WidgetContainer()
+    {
+        setMaxSize(Size::Max);
+        addListener<ScrollEvent>([&](const ScrollEvent& evt) {
+            onScroll(evt);
+            return false;
+        });
+    }
+
+    void ListView::setDataSource(DataSource source)
+    {
+        m_source = std::move(source);
+        clear();
+        m_boundRows.clear();
+        reloadData();
+    }
+
+    void ListView::reloadData()
+    {
+        m_rowCount = (m_source.count) ? m_source.count() : 0;
+
+        // Content of every row might have changed.
+        std::fill(m_boundRows.begin(), m_boundRows.end(), npos);
+        m_scrollOffset = std::min(m_scrollOffset, maxScrollOffset());
+        layoutRows();
+        draw();
+    }
+
+    void ListView::setRowHeight(Size::value_type height)
+    {
+        if (m_rowHeight != height)
+        {
+            m_rowHeight = height;
+            m_scrollOffset = std::min(m_scrollOffset, maxScrollOffset());
+            layoutRows();
+            draw();
+        }
+    }
+
+    void ListView::setScrollOffset(uint64_t offset)
+    {
+        offset = std::min(offset, maxScrollOffset());
+        if (m_scrollOffset != offset)
+        {
+            m_scrollOffset = offset;
+            layoutRows();
+            draw();
+        }
+    }
+
+    void ListView::scrollToRow(size_type index)
+    {
+        if (index >= m_rowCount)
+            return;
+
+        const uint64_t top{static_cast<uint64_t>(index) * m_rowHeight};
+        const uint64_t bottom{top + m_rowHeight};
+        const uint64_t height{getSize().height};
+
+        if (top < m_scrollOffset)
+            setScrollOffset(top);
+        else if (bottom > m_scrollOffset + height)
+            setScrollOffset((bottom > height) ? bottom - height : 0);
+    }
+
+    ListView::size_type ListView::firstVisibleRow() const noexcept
+    {
+        if ((m_rowCount == 0) || (m_rowHeight == 0))
+            return npos;
+
+        return std::min<size_type>(static_cast<size_type>(m_scrollOffset / m_rowHeight), m_rowCount - 1);
+    }
+
+    ListView::size_type ListView::visibleRowCount() const noexcept
+    {
+        const size_type first{firstVisibleRow()};
+        if (first == npos)
+            return 0;
+
+        const uint64_t end{m_scrollOffset + getSize().height};
+        const auto last{static_cast<size_type>((end + m_rowHeight - 1) / m_rowHeight)};
+        return std::min(last, m_rowCount) - first;
+    }
+
+    ListView::size_type ListView::rowOf(const Widget* widget) const noexcept
+    {
+        for (size_type slot{0}; slot < count(); ++slot)
+            if (at(slot).get() == widget)
+                return m_boundRows[slot];
+
+        return npos;
+    }
+
+    void ListView::onDraw(Canvas* canvas)
+    {
+        drawBackground(canvas);
+
+        // Rows at the edges are only partially visible.
+        canvas->save();
+        canvas->clipRect(getPosition(), getSize());
+        for (size_type slot{0}; slot < count(); ++slot)
+        {
+            const value_type& widget{at(slot)};
+            if ((m_boundRows[slot] != npos) && !canvas->quickReject(widget->getPosition(), widget->getSize()))
+                widget->drawCached(canvas);
+        }
+        canvas->restore();
+    }
+
+    void ListView::onSizeChange(const Size&)
+    {
+        m_scrollOffset = std::min(m_scrollOffset, maxScrollOffset());
+        layoutRows();
+        reportDamage();
+    }
+
+    WidgetContainer::const_iterator ListView::findChildAtPos(const Point& pos) const
+    {
+        const Point start{getPosition()};
+        const Size size{getSize()};
+        if ((count() == 0) || (m_rowHeight == 0) || (pos.x < start.x) || (pos.y < start.y) ||
+            (pos.x > start.x + static_cast<Point::value_type>(size.width)) ||
+            (pos.y >= start.y + static_cast<Point::value_type>(size.height)))
+            return cend();
+
+        const uint64_t y{static_cast<uint64_t>(pos.y - start.y) + m_scrollOffset};
+        const auto row{static_cast<size_type>(y / m_rowHeight)};
+        const size_type slot{row % count()};
+        if ((row >= m_rowCount) || (m_boundRows[slot] != row))
+            return cend();
+
+        return cbegin() + static_cast<container_type::difference_type>(slot);
+    }
+
+    void ListView::onScroll(const ScrollEvent& evt)
+    {
+        // Positive offset is scrolling up.
+        const auto delta{static_cast<int64_t>(-evt.offset.y * m_scrollStep)};
+        if (delta < 0)
+        {
+            const auto distance{static_cast<uint64_t>(-delta)};
+            setScrollOffset((distance > m_scrollOffset) ? 0 : m_scrollOffset - distance);
+        }
+        else if (delta > 0)
+        {
+            setScrollOffset(m_scrollOffset + static_cast<uint64_t>(delta));
+        }
+    }
+
+    void ListView::layoutRows()
+    {
+        const Size size{getSize()};
+        BatchUpdate batch{*this};
+
+        // A partially visible row at the top and bottom.
+        const size_type visible{(m_rowHeight > 0) ? (size.height / m_rowHeight) + 2 : 0};
+        const size_type poolSize{(m_source.create) ? std::min(m_rowCount, visible) : 0};
+
+        if (poolSize != count())
+        {
+            while (count() > poolSize)
+            {
+                const value_type widget{back()};
+                remove(widget);
+            }
+            while (count() < poolSize)
+            {
+                value_type widget{m_source.create()};
+                if (!widget)
+                    break;
+                add(widget);
+            }
+
+            // Row to widget mapping depends on the pool size.
+            m_boundRows.assign(count(), npos);
+        }
+
+        const size_type first{firstVisibleRow()};
+        if ((count() == 0) || (first == npos))
+            return;
+
+        const Point pos{getPosition()};
+        const auto shift{static_cast<Point::value_type>(m_scrollOffset % m_rowHeight)};
+        const size_type last{std::min(first + count(), m_rowCount)};
+        for (size_type row{first}; row < last; ++row)
+        {
+            const size_type slot{row % count()};
+            Widget* widget{at(slot).get()};
+            if (m_boundRows[slot] != row)
+            {
+                if (m_source.bind)
+                    m_source.bind(*widget, row);
+                m_boundRows[slot] = row;
+            }
+
+            const auto y{static_cast<Point::value_type>((row - first) * m_rowHeight) - shift};
+            widget->setSize({size.width, m_rowHeight});
+            widget->setPosHint({pos.x, pos.y + y});
+        }
+
+        // Widgets without a row in view are not drawn or hit-tested.
+        for (size_type& row : m_boundRows)
+            if ((row < first) || (row >= last))
+                row = npos;
+    }
+
+    uint64_t ListView::maxScrollOffset() const noexcept
+    {
+        const uint64_t total{static_cast<uint64_t>(m_rowCount) * m_rowHeight};
+        const uint64_t height{getSize().height};
+        return (total > height) ? total - height : 0;
+    }
+} // namespace pTK
@@ -0,0 +1,139 @@
+//
+//  widgets/TextArea.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// pTK Headers
+#include "ptk/widgets/TextArea.hpp"
+#include "ptk/util/Math.hpp"
+
+// Skia Headers
+PTK_DISABLE_WARN_BEGIN()
+#include "include/core/SkCanvas.h"
+PTK_DISABLE_WARN_END()
+
+// C++ Headers
+#include <utility>
+
+namespace pTK
+{
+    TextArea::TextArea()
+        : Widget(),
+          Text()
+    {
+        m_layout.setFont(skFont());
+    }
+
+    void TextArea::onDraw(Canvas* canvas)
+    {
+        updateVisibleLines(canvas);
+
+        const Point pos{getPosition()};
+        const float lineHeight{m_layout.lineHeight()};
+        for (std::size_t i{0}; i < m_visibleLines.size(); ++i)
+        {
+            // The baseline is placed at the ascent of the line, instead of the cap height.
+            const ShapedText& line{m_visibleLines[i]};
+            const float top{static_cast<float>(pos.y) + static_cast<float>(m_visibleFirst + i) * lineHeight};
+            const Vec2f linePos{static_cast<float>(pos.x) - line.offset().x,
+                                top + m_layout.ascent() - line.offset().y};
+            canvas->drawShapedText(line, m_color, linePos);
+        }
+    }
+
+    void TextArea::updateVisibleLines(const Canvas* canvas)
+    {
+        const SkRect clip{canvas->skCanvas->getLocalClipBounds()};
+        const auto y{static_cast<float>(getPosition().y)};
+        const auto [first, last] = m_layout.linesBetween(clip.top() - y, clip.bottom() - y);
+        if (m_visibleValid && (first == m_visibleFirst) && ((last - first) == m_visibleLines.size()))
+            return;
+
+        // Lines that are still visible are kept, scrolling only shapes the new lines.
+        const std::size_t oldLast{m_visibleFirst + m_visibleLines.size()};
+        std::vector<ShapedText> lines(last - first);
+        for (std::size_t i{first}; i < last; ++i)
+        {
+            if (m_visibleValid && (i >= m_visibleFirst) && (i < oldLast))
+                lines[i - first] = std::move(m_visibleLines[i - m_visibleFirst]);
+            else
+            {
+                const TextLayout::Line line{m_layout.line(i)};
+                lines[i - first] = ShapedText{getText().data() + line.start, line.end - line.start,
+                                              SkTextEncoding::kUTF8, skFont()};
+            }
+        }
+
+        m_visibleLines = std::move(lines);
+        m_visibleFirst = first;
+        m_visibleValid = true;
+    }
+
+    void TextArea::onTextUpdate()
+    {
+        m_layout.setFont(skFont());
+        updateLayout();
+    }
+
+    void TextArea::onSizeChange(const Size&)
+    {
+        if (m_wordWrap)
+            updateLayout();
+        reportDamage();
+    }
+
+    void TextArea::updateLayout()
+    {
+        // Only the lines affected by a new width are broken again.
+        m_layout.setWidth((m_wordWrap) ? static_cast<float>(getSize().width) : 0.0f);
+        m_visibleValid = false;
+
+        Size minSize{getMinSize()};
+        minSize.height = static_cast<Size::value_type>(Math::ceilf(m_layout.height()));
+        if (!m_wordWrap)
+            minSize.width = static_cast<Size::value_type>(Math::ceilf(m_layout.maxLineWidth()));
+        setMinSize(minSize);
+    }
+
+    void TextArea::setText(const std::string& str)
+    {
+        m_layout.setText(str);
+        updateLayout();
+        draw();
+    }
+
+    const std::string& TextArea::getText() const noexcept
+    {
+        return m_layout.text();
+    }
+
+    void TextArea::setWordWrap(bool wrap)
+    {
+        m_wordWrap = wrap;
+        updateLayout();
+        draw();
+    }
+
+    bool TextArea::getWordWrap() const noexcept
+    {
+        return m_wordWrap;
+    }
+
+    const Color& TextArea::getColor() const
+    {
+        return m_color;
+    }
+
+    void TextArea::setColor(const Color& color)
+    {
+        m_color = color;
+        draw();
+    }
+
+    const TextLayout& TextArea::layout() const noexcept
+    {
+        return m_layout;
+    }
+} // namespace pTK
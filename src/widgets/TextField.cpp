@@ -9,6 +9,7 @@
 #include "ptk/widgets/TextField.hpp"
 #include "ptk/core/ContextBase.hpp"
 #include "ptk/util/Math.hpp"
+#include "ptk/util/UTF.hpp"
 
 // C++ Headers
 #include <cctype>
@@ -32,7 +33,7 @@ namespace pTK
         });
 
         onInput([this](const InputEvent& evt) {
-            handleInput(evt.data, evt.size, evt.encoding);
+            handleInput(evt);
             return false;
         });
 
@@ -60,13 +61,13 @@ namespace pTK
             case Key::Left:
             case Key::Right:
             {
-                moveCursor(((keycode == Key::Left) ? -1 : 1), getText().size(), true);
+                moveCursor(((keycode == Key::Left) ? -1 : 1), true);
                 break;
             }
             case Key::Home:
             case Key::End:
             {
-                moveCursorToPos(((keycode == Key::Home) ? 0 : getText().size()), getText().size(), true);
+                moveCursorToPos(((keycode == Key::Home) ? 0 : m_buffer.size()), true);
                 break;
             }
             default:
@@ -76,77 +77,177 @@ namespace pTK
 
     void TextField::removeFromText(int direction)
     {
-        if (direction > 0)
+        // Removes the char after (Delete) or before (Backspace) the cursor.
+        const std::size_t first{(direction > 0) ? m_cursorLocation : prevCharPos(m_cursorLocation)};
+        const std::size_t last{(direction > 0) ? nextCharPos(m_cursorLocation) : m_cursorLocation};
+        if (first == last)
+            return;
+
+        const float advance{advanceBetween(first, last)};
+        m_buffer.erase(first, last - first);
+        m_advances.erase(first, last - first);
+        m_textAdvance -= advance;
+
+        // The first visible char moves with the text.
+        if (last <= m_visibleFirst)
         {
-            if (m_cursorLocation < getText().size())
-            {
-                std::string str{getText()};
-                str.erase(m_cursorLocation, 1);
-                setText(str);
-            }
+            m_visibleFirst -= last - first;
+            m_visibleAdvance -= advance;
         }
-        else
+
+        if (direction < 0)
         {
-            if (m_cursorLocation > 0)
-            {
-                std::string str{getText()};
-                str.erase(m_cursorLocation - 1, 1);
-                moveCursor(-1, str.size());
-                setText(str);
-            }
+            m_cursorLocation = first;
+            m_cursorAdvance -= advance;
         }
+
+        textChanged();
+        draw();
     }
 
-    void TextField::handleInput(const std::unique_ptr<uint32_t[]>& data, std::size_t size, Text::Encoding)
+    void TextField::handleInput(const InputEvent& evt)
     {
-        // This currently ignores the encoding.
-        // TODO: Fix encoding for the data.
-
-        std::string toAdd{};
+        // Code points are stored as UTF-8.
+        char buffer[InputEvent::capacity * 4];
+        std::size_t size{0};
+        for (std::size_t i{0}; i < evt.size; ++i)
+            size += UTF::EncodeUTF8(evt.data[i], buffer + size);
 
-        for (std::size_t i{0}; i < size; ++i)
-            toAdd += static_cast<char>(data[i]);
-
-        m_text.insert(m_cursorLocation, toAdd);
-        moveCursor(static_cast<int>(size), m_text.size());
-        onTextUpdate();
+        insertText(buffer, size);
     }
 
-    void TextField::moveCursor(int direction, std::size_t strSize, bool shouldDraw)
+    void TextField::insertText(const char* text, std::size_t size)
     {
-        bool sDraw{false};
+        // Only the inserted text is measured (SkFont advances do not depend on the neighbours).
+        m_buffer.insert(m_cursorLocation, text, size);
+        const float advance{MeasureAdvances(skFont(), text, size, m_advances.insert(m_cursorLocation, size))};
 
-        if (direction > 0)
+        // The first visible char moves with the text.
+        if (m_cursorLocation < m_visibleFirst)
         {
-            if ((m_cursorLocation + static_cast<std::size_t>(direction)) <= strSize)
-            {
-                m_cursorLocation += static_cast<std::size_t>(direction);
-                sDraw = true;
-            }
+            m_visibleFirst += size;
+            m_visibleAdvance += advance;
         }
-        else if (direction < 0)
-        {
-            int cursorLoc = static_cast<int>(m_cursorLocation);
-            if (cursorLoc + direction > 0)
-                m_cursorLocation = static_cast<std::size_t>(cursorLoc + direction);
-            else
-                m_cursorLocation = 0;
+        m_cursorLocation += size;
+        m_cursorAdvance += advance;
+        m_textAdvance += advance;
 
-            sDraw = true;
-        }
+        textChanged();
+    }
+
+    void TextField::moveCursor(int direction, bool shouldDraw)
+    {
+        const std::size_t pos{(direction > 0) ? nextCharPos(m_cursorLocation) : prevCharPos(m_cursorLocation)};
+        moveCursorToPos(pos, shouldDraw);
+    }
+
+    void TextField::moveCursorToPos(std::size_t pos, bool shouldDraw)
+    {
+        if ((m_cursorLocation == pos) || (pos > m_buffer.size()))
+            return;
+
+        // Only the advance between the old and new position is summed.
+        if (pos == 0)
+            m_cursorAdvance = 0.0f;
+        else if (pos == m_buffer.size())
+            m_cursorAdvance = m_textAdvance;
+        else if (pos > m_cursorLocation)
+            m_cursorAdvance += advanceBetween(m_cursorLocation, pos);
+        else
+            m_cursorAdvance -= advanceBetween(pos, m_cursorLocation);
 
-        if (sDraw && shouldDraw)
+        m_cursorLocation = pos;
+        if (shouldDraw)
             draw();
     }
 
-    void TextField::moveCursorToPos(std::size_t pos, std::size_t strSize, bool shouldDraw)
+    std::size_t TextField::nextCharPos(std::size_t pos) const
+    {
+        const std::size_t size{m_buffer.size()};
+        if (pos >= size)
+            return size;
+
+        do
+            ++pos;
+        while ((pos < size) && !UTF::IsCharStart(m_buffer[pos]));
+
+        return pos;
+    }
+
+    std::size_t TextField::prevCharPos(std::size_t pos) const
+    {
+        if (pos == 0)
+            return 0;
+
+        do
+            --pos;
+        while ((pos > 0) && !UTF::IsCharStart(m_buffer[pos]));
+
+        return pos;
+    }
+
+    float TextField::advanceBetween(std::size_t first, std::size_t last) const
+    {
+        float advance{0.0f};
+        m_advances.forEachSpan(first, last - first, [&advance](const float* data, std::size_t count) {
+            for (std::size_t i{0}; i < count; ++i)
+                advance += data[i];
+        });
+
+        return advance;
+    }
+
+    void TextField::textChanged()
     {
-        if ((m_cursorLocation != pos) && (pos <= strSize))
+        m_textValid = false;
+        m_visibleValid = false;
+        updateBounds();
+    }
+
+    void TextField::updateVisibleText(const Canvas* canvas)
+    {
+        // Only the visible part of the text is shaped, long text is mostly clipped.
+        const SkRect clip{canvas->skCanvas->getLocalClipBounds()};
+        const float left{clip.left() - m_textPos.x};
+        const float right{clip.right() - m_textPos.x};
+        if (m_visibleValid && (left == m_visibleLeft) && (right == m_visibleRight))
+            return;
+
+        // The search starts at the first visible char of the last draw, only the chars
+        // scrolled past are visited (and not all the chars before the visible text).
+        const std::size_t size{m_buffer.size()};
+        std::size_t first{m_visibleFirst};
+        float start{m_visibleAdvance};
+        while ((first > 0) && (start >= left))
+        {
+            first = prevCharPos(first);
+            start -= m_advances[first];
+        }
+        while ((first < size) && (start + m_advances[first] < left))
+        {
+            start += m_advances[first];
+            first = nextCharPos(first);
+        }
+
+        std::size_t last{first};
+        float end{start};
+        while ((last < size) && (end <= right))
         {
-            m_cursorLocation = pos;
-            if (shouldDraw)
-                draw();
+            end += m_advances[last];
+            last = nextCharPos(last);
         }
+
+        std::string visible{};
+        visible.reserve(last - first);
+        m_buffer.forEachSpan(first, last - first,
+                             [&visible](const char* data, std::size_t count) { visible.append(data, count); });
+        updateShapedText(visible);
+
+        m_visibleFirst = first;
+        m_visibleAdvance = start;
+        m_visibleLeft = left;
+        m_visibleRight = right;
+        m_visibleValid = true;
     }
 
     void TextField::onDraw(Canvas* canvas)
@@ -155,30 +256,23 @@ namespace pTK
                               getOutlineThickness());
 
         const Size rectSize{getSize()};
-        const SkFont* font = &skFont();
-
-        const Text::StrData textData{getText().c_str(), getText().size(), Text::Encoding::UTF8};
-        float advance = (!getText().empty()) ? canvas->drawTextLine(textData, m_textColor, m_textPos, font) : 0.0f;
 
-        if (getText().empty())
+        if (!m_buffer.empty())
         {
-            const Text::StrData placeholderStrData{m_placeholderText.c_str(), m_placeholderText.size(),
-                                                   Text::Encoding::UTF8};
-            canvas->drawTextLine(placeholderStrData, m_placeholderColor, m_textPos, font);
+            // The visible text is drawn at its advance in the text.
+            updateVisibleText(canvas);
+            const Vec2f pos{m_textPos.x + m_visibleAdvance - shapedText().offset().x, m_textPos.y};
+            canvas->drawShapedText(shapedText(), m_textColor, pos);
         }
+        else
+            canvas->drawShapedText(m_placeholderShaped, m_placeholderColor, m_textPos);
 
         if (m_drawCursor)
         {
             SkPaint paint{GetSkPaintFromColor(m_textColor)};
             paint.setStrokeWidth(1.0f);
 
-            if (m_cursorLocation <= getText().size())
-            {
-                SkRect tmp{};
-                advance = skFont().measureText(getText().c_str(), m_cursorLocation, SkTextEncoding::kUTF8, &tmp);
-            }
-
-            float posX = m_textPos.x + advance - ((m_cursorLocation == 0) ? 2.0f : 0.0f);
+            float posX = m_textPos.x + m_cursorAdvance - ((m_cursorLocation == 0) ? 2.0f : 0.0f);
 
             float startY =
                 static_cast<float>(getPosition().y) + ((static_cast<float>(rectSize.height) - m_cursorHeight) / 2);
@@ -189,10 +283,19 @@ namespace pTK
 
     void TextField::onTextUpdate()
     {
+        // Font might have changed, the text is measured and the placeholder shaped again.
+        const std::string& text{getText()};
+        m_advances.clear();
+        m_textAdvance = MeasureAdvances(skFont(), text.data(), text.size(), m_advances.insert(0, text.size()));
+        if (m_cursorLocation > m_buffer.size())
+            m_cursorLocation = m_buffer.size();
+        m_cursorAdvance = advanceBetween(0, m_cursorLocation);
+
+        m_placeholderShaped = shapeStr(m_placeholderText);
+        m_visibleFirst = 0;
+        m_visibleAdvance = 0.0f;
+        m_visibleValid = false;
         updateBounds();
-
-        if (m_text.size() < m_cursorLocation)
-            m_cursorLocation = m_text.size();
     }
 
     void TextField::setPosHint(const Point& pos)
@@ -203,13 +306,24 @@ namespace pTK
 
     void TextField::setText(const std::string& text)
     {
+        m_buffer.assign(text.data(), text.size());
         m_text = text;
+        m_textValid = true;
         onTextUpdate();
         draw();
     }
 
     const std::string& TextField::getText() const
     {
+        if (!m_textValid)
+        {
+            m_text.clear();
+            m_text.reserve(m_buffer.size());
+            m_buffer.forEachSpan(0, m_buffer.size(),
+                                 [this](const char* data, std::size_t count) { m_text.append(data, count); });
+            m_textValid = true;
+        }
+
         return m_text;
     }
 
@@ -270,15 +384,11 @@ namespace pTK
 
         m_cursorHeight = ascentToDescent();
 
-        Vec2f bounds{getBoundsFromStr(getText())};
-        bounds.x = Math::ceilf(bounds.x);
-        bounds.y = Math::ceilf(bounds.y);
-        Size minSize{Size::MakeNarrow(bounds.x, bounds.y)};
+        // The cached advance is used, the text is not measured again.
+        Size minSize{Size::MakeNarrow(Math::ceilf(m_textAdvance), Math::ceilf(m_cursorHeight))};
         minSize.width += 1;
-        auto ceilCursorHeight = static_cast<Size::value_type>(std::ceil(m_cursorHeight));
-        minSize.height = (minSize.height > ceilCursorHeight) ? minSize.height : ceilCursorHeight;
 
-        Vec2f placeholderBounds{getBoundsFromStr(m_placeholderText)};
+        Vec2f placeholderBounds{m_placeholderShaped.bounds()};
         placeholderBounds.x = Math::ceilf(placeholderBounds.x);
         placeholderBounds.y = Math::ceilf(placeholderBounds.y);
         Size placeholderSize{Size::MakeNarrow(placeholderBounds.x, placeholderBounds.y)};
@@ -293,6 +403,7 @@ namespace pTK
     void TextField::setPlaceholderText(const std::string& text)
     {
         m_placeholderText = text;
+        m_placeholderShaped = shapeStr(m_placeholderText);
         updateBounds();
     }
 
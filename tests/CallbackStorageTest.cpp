@@ -10,9 +10,12 @@
 
 // pTK Headers
 #include "ptk/core/CallbackStorage.hpp"
+#include "ptk/core/EventCallbacks.hpp"
 
 // C++ Headers
 #include <cstdint>
+#include <typeindex>
+#include <vector>
 
 static auto ZeroCallback = []() {
     return false;
@@ -135,18 +138,28 @@ TEST_CASE("CallbackContainer")
 
 TEST_CASE("CallbackIndexGen")
 {
-    const auto index1 = std::type_index(typeid(pTK::CallbackIndexType<int8_t, bool()>));
-    REQUIRE(pTK::CallbackIndexGen::GetIndex<int8_t, bool()>() == index1);
+    const auto index1 = pTK::CallbackIndexGen::GetIndex<int8_t, bool()>();
     REQUIRE(pTK::CallbackIndexGen::GetIndex<int8_t, bool()>() == index1); // Same as the above.
 
-    const auto index2 = std::type_index(typeid(pTK::CallbackIndexType<int8_t, bool(int)>));
-    const auto index3 = std::type_index(typeid(pTK::CallbackIndexType<int8_t, bool(unsigned int)>));
-    REQUIRE(pTK::CallbackIndexGen::GetIndex<int8_t, bool(int)>() == index2);
-    REQUIRE(pTK::CallbackIndexGen::GetIndex<int8_t, bool(unsigned int)>() == index3);
+    const auto index2 = pTK::CallbackIndexGen::GetIndex<int8_t, bool(int)>();
+    const auto index3 = pTK::CallbackIndexGen::GetIndex<int8_t, bool(unsigned int)>();
+    REQUIRE(index2 != index1);
+    REQUIRE(index3 != index1);
+    REQUIRE(index3 != index2);
 
-    const auto index4 = std::type_index(typeid(pTK::CallbackIndexType<uint8_t, bool()>));
+    const auto index4 = pTK::CallbackIndexGen::GetIndex<uint8_t, bool()>();
     REQUIRE(pTK::CallbackIndexGen::GetIndex<int8_t, bool()>() == index1); // Same as the first.
-    REQUIRE(pTK::CallbackIndexGen::GetIndex<uint8_t, bool()>() == index4);
+    REQUIRE(index4 != index1);
+
+    // Registering the same type again gives the same index.
+    REQUIRE(pTK::CallbackIndexGen::Register(std::type_index(typeid(pTK::CallbackIndexType<uint8_t, bool()>))) ==
+            index4);
+
+    // Indices are dense.
+    REQUIRE(index1 < 32);
+    REQUIRE(index2 < 32);
+    REQUIRE(index3 < 32);
+    REQUIRE(index4 < 32);
 }
 
 TEST_CASE("CallbackStorage")
@@ -407,3 +420,151 @@ TEST_CASE("CallbackStorage")
         callbacks2->triggerCallbacks(count);
     }
 }
+
+struct DispatchEvent
+{
+    int value{0};
+};
+
+TEST_CASE("Dispatch")
+{
+    // Testing adding and removing listeners while an event is dispatched.
+
+    pTK::EventCallbacks callbacks{};
+    const pTK::CallbackStorage& storage{callbacks.callbackStorage()};
+    std::vector<int> calls{};
+
+    SECTION("One-shot listeners")
+    {
+        for (int i{0}; i < 1000; ++i)
+            callbacks.addListener<DispatchEvent>([&calls, i]() {
+                calls.push_back(i);
+                return true;
+            });
+        REQUIRE(storage.count() == 1000);
+
+        callbacks.triggerEvent<DispatchEvent>(DispatchEvent{});
+        REQUIRE(calls.size() == 1000);
+        REQUIRE(calls.back() == 999);
+        REQUIRE(storage.count() == 0);
+        REQUIRE(storage.size() == 0);
+    }
+
+    SECTION("Remove self")
+    {
+        uint64_t id{0};
+        id = callbacks.addListener<DispatchEvent>([&]() {
+            calls.push_back(0);
+            REQUIRE(callbacks.removeListener<DispatchEvent>(id));
+            return false;
+        });
+        callbacks.addListener<DispatchEvent>([&]() {
+            calls.push_back(1);
+            return false;
+        });
+
+        callbacks.triggerEvent<DispatchEvent>(DispatchEvent{});
+        REQUIRE(calls == std::vector<int>{0, 1});
+        REQUIRE(storage.count() == 1);
+
+        callbacks.triggerEvent<DispatchEvent>(DispatchEvent{});
+        REQUIRE(calls == std::vector<int>{0, 1, 1});
+    }
+
+    SECTION("Remove other")
+    {
+        uint64_t id{0};
+        callbacks.addListener<DispatchEvent>([&]() {
+            calls.push_back(0);
+            REQUIRE(callbacks.removeListener<DispatchEvent>(id));
+            return false;
+        });
+        id = callbacks.addListener<DispatchEvent>([&]() {
+            calls.push_back(1);
+            return false;
+        });
+
+        callbacks.triggerEvent<DispatchEvent>(DispatchEvent{});
+        REQUIRE(calls == std::vector<int>{0});
+        REQUIRE(storage.count() == 1);
+        REQUIRE_FALSE(callbacks.removeListener<DispatchEvent>(id));
+    }
+
+    SECTION("Remove all")
+    {
+        uint64_t id1{0};
+        uint64_t id2{0};
+        id1 = callbacks.addListener<DispatchEvent>([&]() {
+            calls.push_back(0);
+            callbacks.removeListener<DispatchEvent>(id1);
+            callbacks.removeListener<DispatchEvent>(id2);
+            return false;
+        });
+        id2 = callbacks.addListener<DispatchEvent>([&]() {
+            calls.push_back(1);
+            return false;
+        });
+
+        callbacks.triggerEvent<DispatchEvent>(DispatchEvent{});
+        REQUIRE(calls == std::vector<int>{0});
+        REQUIRE(storage.count() == 0);
+        REQUIRE(storage.size() == 0);
+    }
+
+    SECTION("Add")
+    {
+        callbacks.addListener<DispatchEvent>([&]() {
+            calls.push_back(0);
+            callbacks.addListener<DispatchEvent>([&]() {
+                calls.push_back(1);
+                return true;
+            });
+            return true;
+        });
+
+        // Listener added during dispatch is not called in the same dispatch.
+        callbacks.triggerEvent<DispatchEvent>(DispatchEvent{});
+        REQUIRE(calls == std::vector<int>{0});
+        REQUIRE(storage.count() == 1);
+
+        callbacks.triggerEvent<DispatchEvent>(DispatchEvent{});
+        REQUIRE(calls == std::vector<int>{0, 1});
+        REQUIRE(storage.count() == 0);
+    }
+
+    SECTION("Add and remove")
+    {
+        callbacks.addListener<DispatchEvent>([&]() {
+            const uint64_t id{callbacks.addListener<DispatchEvent>([&]() {
+                calls.push_back(1);
+                return false;
+            })};
+            REQUIRE(callbacks.removeListener<DispatchEvent>(id));
+            calls.push_back(0);
+            return true;
+        });
+
+        callbacks.triggerEvent<DispatchEvent>(DispatchEvent{});
+        callbacks.triggerEvent<DispatchEvent>(DispatchEvent{});
+        REQUIRE(calls == std::vector<int>{0});
+        REQUIRE(storage.count() == 0);
+    }
+
+    SECTION("Nested")
+    {
+        callbacks.addListener<DispatchEvent>([&](const DispatchEvent& evt) {
+            calls.push_back(evt.value);
+            if (evt.value == 0)
+                callbacks.triggerEvent<DispatchEvent>(DispatchEvent{1});
+            return false;
+        });
+        callbacks.addListener<DispatchEvent>([&](const DispatchEvent& evt) {
+            calls.push_back(10 + evt.value);
+            return true; // Removed in the nested dispatch.
+        });
+
+        callbacks.triggerEvent<DispatchEvent>(DispatchEvent{0});
+        REQUIRE(calls == std::vector<int>{0, 1, 11});
+        REQUIRE(storage.count() == 1);
+    }
+}
@@ -0,0 +1,121 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/core/CommandQueue.hpp"
+
+// C++ Headers
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Push and run")
+{
+    // Testing the queue from a single thread.
+
+    pTK::CommandQueue<void()> queue{};
+    std::vector<int> order{};
+    REQUIRE(queue.empty());
+
+    SECTION("FIFO")
+    {
+        for (int i{0}; i < 5; ++i)
+            queue.push([&order, i]() { order.push_back(i); });
+        REQUIRE_FALSE(queue.empty());
+
+        REQUIRE(queue.run() == 5);
+        REQUIRE(order == std::vector<int>{0, 1, 2, 3, 4});
+        REQUIRE(queue.empty());
+        REQUIRE(queue.run() == 0);
+    }
+
+    SECTION("Notify")
+    {
+        // Only the push to an empty queue should notify.
+        REQUIRE(queue.push([]() {}));
+        REQUIRE_FALSE(queue.push([]() {}));
+        REQUIRE_FALSE(queue.push([]() {}));
+
+        queue.run();
+        REQUIRE(queue.push([]() {}));
+        REQUIRE_FALSE(queue.push([]() {}));
+    }
+
+    SECTION("Push while running")
+    {
+        queue.push([&]() {
+            order.push_back(0);
+            queue.push([&order]() { order.push_back(1); });
+        });
+
+        REQUIRE(queue.run() == 2);
+        REQUIRE(order == std::vector<int>{0, 1});
+
+        // The push from the command must not leave the queue signaled.
+        REQUIRE(queue.push([]() {}));
+    }
+
+    SECTION("Large command")
+    {
+        std::array<int, 32> data{};
+        data[31] = 7;
+        queue.push([&order, data]() { order.push_back(data[31]); });
+
+        queue.run();
+        REQUIRE(order == std::vector<int>{7});
+    }
+
+    SECTION("Destroy")
+    {
+        auto counter = std::make_shared<int>(0);
+        {
+            pTK::CommandQueue<void()> other{};
+            other.push([counter]() { ++(*counter); });
+            other.push([counter]() { ++(*counter); });
+            REQUIRE(counter.use_count() == 3);
+        }
+        REQUIRE(counter.use_count() == 1);
+        REQUIRE(*counter == 0);
+    }
+}
+
+TEST_CASE("Multiple producers")
+{
+    // Testing that commands from several threads are all run in order per thread.
+
+    constexpr std::size_t producers{4};
+    constexpr std::size_t commands{20000};
+
+    pTK::CommandQueue<void()> queue{};
+    std::array<std::size_t, producers> next{};
+    std::size_t outOfOrder{0};
+    std::size_t total{0};
+
+    std::vector<std::thread> threads{};
+    for (std::size_t p{0}; p < producers; ++p)
+    {
+        threads.emplace_back([&, p]() {
+            for (std::size_t i{0}; i < commands; ++i)
+                queue.push([&, p, i]() {
+                    if (next[p] != i)
+                        ++outOfOrder;
+                    next[p] = i + 1;
+                    ++total;
+                });
+        });
+    }
+
+    // Consume while producing.
+    while (total < producers * commands)
+        queue.run();
+
+    for (std::thread& thread : threads)
+        thread.join();
+    queue.run();
+
+    REQUIRE(total == producers * commands);
+    REQUIRE(outOfOrder == 0);
+    REQUIRE(queue.empty());
+}
@@ -0,0 +1,125 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/core/DamageRegion.hpp"
+#include "ptk/core/WidgetContainer.hpp"
+
+// C++ Headers
+#include <vector>
+
+TEST_CASE("Add")
+{
+    // Testing adding damaged areas.
+
+    SECTION("Empty")
+    {
+        pTK::DamageRegion region{};
+        region.add(pTK::Rect{{10, 10}, {0, 10}});
+
+        REQUIRE(region.empty());
+        REQUIRE(region.count() == 0);
+    }
+
+    SECTION("Separate")
+    {
+        pTK::DamageRegion region{};
+        region.add(pTK::Rect{{0, 0}, {10, 10}});
+        region.add(pTK::Rect{{50, 50}, {10, 10}});
+
+        REQUIRE(region.count() == 2);
+        REQUIRE(region.bounds() == pTK::Rect{{0, 0}, {60, 60}});
+        REQUIRE(region.intersects(pTK::Rect{{5, 5}, {2, 2}}));
+        REQUIRE_FALSE(region.intersects(pTK::Rect{{20, 20}, {10, 10}}));
+    }
+
+    SECTION("Contained")
+    {
+        pTK::DamageRegion region{};
+        region.add(pTK::Rect{{0, 0}, {10, 10}});
+        region.add(pTK::Rect{{2, 2}, {2, 2}});
+
+        REQUIRE(region.count() == 1);
+        REQUIRE(*region.begin() == pTK::Rect{{0, 0}, {10, 10}});
+    }
+
+    SECTION("Merge overlapping")
+    {
+        pTK::DamageRegion region{};
+        region.add(pTK::Rect{{0, 0}, {10, 10}});
+        region.add(pTK::Rect{{20, 0}, {10, 10}});
+        region.add(pTK::Rect{{5, 0}, {20, 5}}); // Overlaps both.
+
+        REQUIRE(region.count() == 1);
+        REQUIRE(*region.begin() == pTK::Rect{{0, 0}, {30, 10}});
+    }
+
+    SECTION("Collapse")
+    {
+        pTK::DamageRegion region{2};
+        region.add(pTK::Rect{{0, 0}, {5, 5}});
+        region.add(pTK::Rect{{10, 10}, {5, 5}});
+        region.add(pTK::Rect{{20, 20}, {5, 5}});
+
+        REQUIRE(region.count() == 1);
+        REQUIRE(*region.begin() == pTK::Rect{{0, 0}, {25, 25}});
+    }
+
+    SECTION("Clear")
+    {
+        pTK::DamageRegion region{};
+        region.add(pTK::Rect{{0, 0}, {10, 10}});
+        region.clear();
+
+        REQUIRE(region.empty());
+        REQUIRE(region.bounds().isEmpty());
+    }
+}
+
+/**
+    Container that records the damage reported by its children.
+ */
+class DamageRecorder : public pTK::WidgetContainer
+{
+public:
+    std::vector<pTK::Rect> damage{};
+
+private:
+    void addDamage(const pTK::Rect& rect) override { damage.push_back(rect); }
+};
+
+TEST_CASE("Widget damage")
+{
+    // Testing damage reported from Widgets.
+
+    SECTION("draw()")
+    {
+        DamageRecorder container{};
+        auto widget = std::make_shared<pTK::Widget>();
+        widget->setSize({10, 10});
+        container.add(widget);
+
+        container.damage.clear();
+        widget->draw();
+
+        REQUIRE_FALSE(container.damage.empty());
+        REQUIRE(container.damage.back() == widget->getBounds());
+    }
+
+    SECTION("Moved")
+    {
+        DamageRecorder container{};
+        auto widget = std::make_shared<pTK::Widget>();
+        widget->setSize({10, 10});
+        container.add(widget);
+        widget->draw();
+
+        container.damage.clear();
+        widget->setPosHint({50, 50});
+
+        // Both old and new bounds must be reported.
+        REQUIRE(container.damage.size() == 2);
+        REQUIRE(container.damage.at(0) == pTK::Rect{{0, 0}, {10, 10}});
+        REQUIRE(container.damage.at(1) == pTK::Rect{{50, 50}, {10, 10}});
+    }
+}
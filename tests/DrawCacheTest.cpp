@@ -0,0 +1,125 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/core/Widget.hpp"
+#include "ptk/widgets/VBox.hpp"
+
+// Skia Headers
+PTK_DISABLE_WARN_BEGIN()
+#include "include/core/SkCanvas.h"
+#include "include/core/SkSurface.h"
+PTK_DISABLE_WARN_END()
+
+// C++ Headers
+#include <memory>
+
+class CountingWidget : public pTK::Widget
+{
+public:
+    CountingWidget()
+    {
+        setSize({50, 20});
+    }
+
+    void onDraw(pTK::Canvas* canvas) override
+    {
+        ++drawn;
+        canvas->drawRect(getPosition(), getSize(), pTK::Color{0xff0000ff});
+    }
+
+    std::size_t drawn{0};
+};
+
+static pTK::Canvas MakeCanvas(const sk_sp<SkSurface>& surface)
+{
+    return pTK::Canvas{surface->getCanvas()};
+}
+
+TEST_CASE("Policy")
+{
+    // Testing replay of cached drawing.
+
+    sk_sp<SkSurface> surface{SkSurface::MakeRasterN32Premul(200, 200)};
+    pTK::Canvas canvas{MakeCanvas(surface)};
+
+    SECTION("None")
+    {
+        CountingWidget widget{};
+        widget.drawCached(&canvas);
+        widget.drawCached(&canvas);
+
+        REQUIRE(widget.drawn == 2);
+        REQUIRE(widget.getCachePolicy() == pTK::CachePolicy::None);
+        REQUIRE(widget.getCacheStats().hits == 0);
+        REQUIRE(widget.getCacheStats().misses == 0);
+    }
+
+    for (auto policy : {pTK::CachePolicy::Picture, pTK::CachePolicy::Raster})
+    {
+        CountingWidget widget{};
+        widget.setCachePolicy(policy);
+        REQUIRE(widget.getCachePolicy() == policy);
+
+        widget.drawCached(&canvas);
+        widget.drawCached(&canvas);
+        widget.drawCached(&canvas);
+        REQUIRE(widget.drawn == 1);
+        REQUIRE(widget.getCacheStats().misses == 1);
+        REQUIRE(widget.getCacheStats().hits == 2);
+
+        // Widget has changed.
+        widget.draw();
+        widget.drawCached(&canvas);
+        REQUIRE(widget.drawn == 2);
+        REQUIRE(widget.getCacheStats().misses == 2);
+
+        // Widget has moved.
+        widget.setPosHint({10, 10});
+        widget.drawCached(&canvas);
+        REQUIRE(widget.drawn == 3);
+
+        widget.setCachePolicy(pTK::CachePolicy::None);
+        widget.drawCached(&canvas);
+        REQUIRE(widget.drawn == 4);
+        REQUIRE(widget.getCacheStats().misses == 0);
+    }
+}
+
+TEST_CASE("Subtree")
+{
+    // Testing caching of a container and its children.
+
+    sk_sp<SkSurface> surface{SkSurface::MakeRasterN32Premul(200, 200)};
+    pTK::Canvas canvas{MakeCanvas(surface)};
+
+    pTK::VBox box{};
+    auto first = std::make_shared<CountingWidget>();
+    auto second = std::make_shared<CountingWidget>();
+    box.add(first);
+    box.add(second);
+    box.setSize({100, 100});
+    box.setCachePolicy(pTK::CachePolicy::Picture);
+
+    box.drawCached(&canvas);
+    box.drawCached(&canvas);
+    REQUIRE(first->drawn == 1);
+    REQUIRE(second->drawn == 1);
+    REQUIRE(box.getCacheStats().hits == 1);
+
+    // Change in a child invalidates the parent.
+    second->draw();
+    box.drawCached(&canvas);
+    REQUIRE(first->drawn == 2);
+    REQUIRE(second->drawn == 2);
+    REQUIRE(box.getCacheStats().misses == 2);
+
+    // Cached child inside of a cached parent.
+    second->setCachePolicy(pTK::CachePolicy::Raster);
+    box.drawCached(&canvas);
+    first->draw();
+    box.drawCached(&canvas);
+    REQUIRE(first->drawn == 4);
+    REQUIRE(second->drawn == 3);
+    REQUIRE(second->getCacheStats().hits == 1);
+}
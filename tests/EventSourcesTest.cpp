@@ -0,0 +1,158 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/core/EventSources.hpp"
+
+// C++ Headers
+#include <chrono>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Timers")
+{
+    // Testing adding, running and removing timers.
+
+    pTK::EventSources sources{};
+    const pTK::EventSources::time_point start{};
+    std::vector<int> order{};
+
+    SECTION("Timeout")
+    {
+        REQUIRE(sources.timeout(-1, start) == -1);
+        REQUIRE(sources.timeout(100, start) == 100);
+
+        sources.addTimer(10ms, [] {}, false, start);
+        REQUIRE(sources.timeout(-1, start) == 10);
+        REQUIRE(sources.timeout(5, start) == 5);
+        REQUIRE(sources.timeout(-1, start + 9500us) == 1);
+        REQUIRE(sources.timeout(-1, start + 20ms) == 0);
+    }
+
+    SECTION("Order")
+    {
+        sources.addTimer(20ms, [&order] { order.push_back(2); }, false, start);
+        sources.addTimer(10ms, [&order] { order.push_back(1); }, false, start);
+        sources.addTimer(10ms, [&order] { order.push_back(3); }, false, start + 5ms);
+
+        REQUIRE(sources.dispatchTimers(start + 5ms) == 0);
+        REQUIRE(sources.dispatchTimers(start + 20ms) == 3);
+        REQUIRE(order == std::vector<int>{1, 3, 2});
+        REQUIRE(sources.timerCount() == 0);
+    }
+
+    SECTION("Repeat")
+    {
+        int count{0};
+        sources.addTimer(10ms, [&count] { ++count; }, true, start);
+
+        REQUIRE(sources.dispatchTimers(start + 10ms) == 1);
+        REQUIRE(sources.timeout(-1, start + 10ms) == 10);
+
+        // Missed runs are skipped.
+        REQUIRE(sources.dispatchTimers(start + 45ms) == 1);
+        REQUIRE(sources.timeout(-1, start + 45ms) == 10);
+        REQUIRE(count == 2);
+        REQUIRE(sources.timerCount() == 1);
+    }
+
+    SECTION("Remove")
+    {
+        const pTK::EventSources::id_type id{sources.addTimer(10ms, [&order] { order.push_back(1); }, false, start)};
+        REQUIRE(sources.removeTimer(id));
+        REQUIRE_FALSE(sources.removeTimer(id));
+        REQUIRE(sources.dispatchTimers(start + 10ms) == 0);
+        REQUIRE(order.empty());
+    }
+
+    SECTION("Remove while running")
+    {
+        pTK::EventSources::id_type second{0};
+        pTK::EventSources::id_type self{0};
+        self = sources.addTimer(
+            10ms,
+            [&] {
+                order.push_back(1);
+                sources.removeTimer(second);
+                sources.removeTimer(self);
+            },
+            true, start);
+        second = sources.addTimer(10ms, [&order] { order.push_back(2); }, false, start);
+
+        REQUIRE(sources.dispatchTimers(start + 10ms) == 1);
+        REQUIRE(order == std::vector<int>{1});
+        REQUIRE(sources.timerCount() == 0);
+    }
+
+    SECTION("Add while running")
+    {
+        sources.addTimer(
+            10ms,
+            [&] {
+                order.push_back(1);
+                sources.addTimer(0ms, [&order] { order.push_back(2); }, false, start + 10ms);
+            },
+            false, start);
+
+        // Added timers wait until the next dispatch.
+        REQUIRE(sources.dispatchTimers(start + 10ms) == 1);
+        REQUIRE(sources.dispatchTimers(start + 10ms) == 1);
+        REQUIRE(order == std::vector<int>{1, 2});
+    }
+}
+
+TEST_CASE("Watches")
+{
+    // Testing adding, dispatching and removing file descriptor watchers.
+
+    pTK::EventSources sources{};
+    int calledFd{-1};
+    uint32_t calledEvents{0};
+
+    const pTK::EventSources::id_type id{sources.addWatch(7, pTK::EventSources::Readable, [&](int fd, uint32_t events) {
+        calledFd = fd;
+        calledEvents = events;
+    })};
+
+    REQUIRE(sources.watches().size() == 1);
+    REQUIRE(sources.watches().front().fd == 7);
+    REQUIRE(sources.watches().front().events == pTK::EventSources::Readable);
+
+    SECTION("Dispatch")
+    {
+        REQUIRE(sources.dispatchWatch(id, pTK::EventSources::Readable));
+        REQUIRE(calledFd == 7);
+        REQUIRE(calledEvents == pTK::EventSources::Readable);
+    }
+
+    SECTION("Remove")
+    {
+        REQUIRE(sources.removeWatch(id));
+        REQUIRE_FALSE(sources.removeWatch(id));
+        REQUIRE_FALSE(sources.dispatchWatch(id, pTK::EventSources::Readable));
+        REQUIRE(calledFd == -1);
+        REQUIRE(sources.watches().empty());
+    }
+
+    SECTION("Invalid")
+    {
+        // Reported once, then removed.
+        const uint32_t invalid{pTK::EventSources::Error | pTK::EventSources::Invalid};
+        REQUIRE(sources.dispatchWatch(id, invalid));
+        REQUIRE(calledEvents == invalid);
+        REQUIRE(sources.watches().empty());
+        REQUIRE_FALSE(sources.dispatchWatch(id, invalid));
+    }
+
+    SECTION("Remove while running")
+    {
+        const pTK::EventSources::id_type self{sources.addWatch(8, pTK::EventSources::Writable, [&](int, uint32_t) {
+            REQUIRE(sources.removeWatch(id));
+        })};
+
+        REQUIRE(sources.dispatchWatch(self, pTK::EventSources::Writable));
+        REQUIRE(sources.watches().size() == 1);
+        REQUIRE(sources.watches().front().id == self);
+    }
+}
@@ -0,0 +1,99 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/core/FrameScheduler.hpp"
+
+// C++ Headers
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Interval")
+{
+    // Testing the frame interval from the refresh rate.
+
+    pTK::FrameScheduler scheduler{144.0};
+    REQUIRE(scheduler.interval() == 6944444ns);
+
+    scheduler.setRefreshRate(59.94);
+    REQUIRE(scheduler.interval() == 16683350ns);
+
+    scheduler.setRefreshRate(0.0);
+    REQUIRE(scheduler.refreshRate() == 60.0);
+    REQUIRE(scheduler.interval() == 16666667ns);
+}
+
+TEST_CASE("Deadlines")
+{
+    // Testing that the deadlines stay aligned to the refresh interval.
+
+    pTK::FrameScheduler scheduler{100.0};
+    const pTK::FrameScheduler::time_point start{10s};
+
+    // First frame is drawn directly.
+    REQUIRE(scheduler.timeUntilFrame(start) == 0ns);
+
+    scheduler.beginFrame(start);
+    scheduler.endFrame(start + 2ms);
+    REQUIRE(scheduler.deadline() == start + 10ms);
+    REQUIRE(scheduler.timeUntilFrame(start + 2ms) == 8ms);
+
+    SECTION("Continuous")
+    {
+        // Frames started a bit late do not move the deadlines.
+        scheduler.beginFrame(start + 10ms + 300us);
+        scheduler.endFrame(start + 13ms);
+        REQUIRE(scheduler.deadline() == start + 20ms);
+
+        const pTK::FrameScheduler::Stats stats{scheduler.stats()};
+        REQUIRE(stats.frames == 2);
+        REQUIRE(stats.missed == 0);
+    }
+
+    SECTION("Missed")
+    {
+        // Presenting after the next deadline skips it.
+        scheduler.beginFrame(start + 10ms);
+        scheduler.endFrame(start + 25ms);
+        REQUIRE(scheduler.deadline() == start + 30ms);
+        REQUIRE(scheduler.stats().missed == 1);
+    }
+
+    SECTION("Idle")
+    {
+        // After being idle, the deadlines are aligned to the new frame.
+        scheduler.beginFrame(start + 1s + 3ms);
+        scheduler.endFrame(start + 1s + 4ms);
+        REQUIRE(scheduler.deadline() == start + 1s + 13ms);
+        REQUIRE(scheduler.stats().missed == 0);
+    }
+}
+
+TEST_CASE("Stats")
+{
+    // Testing the frame time percentiles.
+
+    pTK::FrameScheduler scheduler{60.0};
+    REQUIRE(scheduler.stats().frames == 0);
+    REQUIRE(scheduler.stats().p50 == 0ns);
+
+    pTK::FrameScheduler::time_point now{1s};
+    for (int i{1}; i <= 100; ++i)
+    {
+        scheduler.beginFrame(now);
+        scheduler.endFrame(now + std::chrono::microseconds{i * 100});
+        now += scheduler.interval();
+    }
+
+    pTK::FrameScheduler::Stats stats{scheduler.stats()};
+    REQUIRE(stats.frames == 100);
+    REQUIRE(stats.missed == 0);
+    REQUIRE(stats.p50 == 5ms);
+    REQUIRE(stats.p99 == 9900us);
+
+    scheduler.resetStats();
+    stats = scheduler.stats();
+    REQUIRE(stats.frames == 0);
+    REQUIRE(stats.p99 == 0ns);
+}
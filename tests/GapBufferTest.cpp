@@ -0,0 +1,133 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/util/GapBuffer.hpp"
+
+// C++ Headers
+#include <string>
+
+static std::string ToString(const pTK::GapBuffer<char>& buffer)
+{
+    std::string str{};
+    buffer.forEachSpan(0, buffer.size(), [&str](const char* data, std::size_t count) { str.append(data, count); });
+    return str;
+}
+
+static void Insert(pTK::GapBuffer<char>& buffer, std::size_t pos, const std::string& str)
+{
+    buffer.insert(pos, str.data(), str.size());
+}
+
+TEST_CASE("Constructors")
+{
+    // Testing Constructors.
+
+    pTK::GapBuffer<char> buffer{};
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(buffer.empty());
+    REQUIRE(ToString(buffer).empty());
+}
+
+TEST_CASE("Editing")
+{
+    // Testing insert and erase at different positions.
+
+    pTK::GapBuffer<char> buffer{};
+    Insert(buffer, 0, "Hello World");
+    REQUIRE(buffer.size() == 11);
+    REQUIRE(ToString(buffer) == "Hello World");
+
+    SECTION("insert")
+    {
+        Insert(buffer, 5, ",");
+        Insert(buffer, 0, ">");
+        Insert(buffer, buffer.size(), "!");
+        REQUIRE(ToString(buffer) == ">Hello, World!");
+        REQUIRE(buffer[0] == '>');
+        REQUIRE(buffer[6] == ',');
+        REQUIRE(buffer[13] == '!');
+    }
+
+    SECTION("insert count")
+    {
+        char* data{buffer.insert(5, 2)};
+        data[0] = ',';
+        data[1] = '_';
+        REQUIRE(ToString(buffer) == "Hello,_ World");
+        buffer.insert(buffer.size(), 1)[0] = '!';
+        REQUIRE(ToString(buffer) == "Hello,_ World!");
+    }
+
+    SECTION("erase")
+    {
+        buffer.erase(5, 6);
+        REQUIRE(ToString(buffer) == "Hello");
+        buffer.erase(0, 1);
+        REQUIRE(ToString(buffer) == "ello");
+        buffer.erase(1, 2);
+        REQUIRE(ToString(buffer) == "eo");
+    }
+
+    SECTION("assign")
+    {
+        const std::string str{"Other"};
+        buffer.assign(str.data(), str.size());
+        REQUIRE(ToString(buffer) == "Other");
+        Insert(buffer, 2, "-");
+        REQUIRE(ToString(buffer) == "Ot-her");
+    }
+
+    SECTION("clear")
+    {
+        buffer.clear();
+        REQUIRE(buffer.empty());
+        Insert(buffer, 0, "New");
+        REQUIRE(ToString(buffer) == "New");
+    }
+
+    SECTION("forEachSpan")
+    {
+        // Gap in the middle of the range.
+        Insert(buffer, 5, "_");
+        std::string str{};
+        std::size_t spans{0};
+        buffer.forEachSpan(2, 6, [&](const char* data, std::size_t count) {
+            str.append(data, count);
+            ++spans;
+        });
+        REQUIRE(str == "llo_ W");
+        REQUIRE(spans == 2);
+    }
+}
+
+TEST_CASE("Typing")
+{
+    // Testing many edits at a moving cursor, compared with std::string.
+
+    pTK::GapBuffer<char> buffer{};
+    std::string expected{};
+    std::size_t cursor{0};
+
+    for (std::size_t i{0}; i < 5000; ++i)
+    {
+        const char c{static_cast<char>('a' + (i % 26))};
+        buffer.insert(cursor, &c, 1);
+        expected.insert(cursor, 1, c);
+        ++cursor;
+
+        if ((i % 7) == 0)
+        {
+            // Backspace.
+            --cursor;
+            buffer.erase(cursor, 1);
+            expected.erase(cursor, 1);
+        }
+
+        if ((i % 97) == 0)
+            cursor /= 2;
+    }
+
+    REQUIRE(buffer.size() == expected.size());
+    REQUIRE(ToString(buffer) == expected);
+}
@@ -0,0 +1,84 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/Window.hpp"
+
+// C++ Headers
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class ColorWidget : public pTK::Widget
+{
+public:
+    explicit ColorWidget(const pTK::Color& color)
+        : m_color{color}
+    {
+        setSizePolicy(pTK::SizePolicy::Type::Fixed);
+        setSize({16, 16});
+    }
+
+    void onDraw(pTK::Canvas* canvas) override { canvas->drawRect(getPosition(), getSize(), m_color); }
+
+private:
+    pTK::Color m_color;
+};
+
+static pTK::Color PixelAt(const std::vector<uint8_t>& pixels, const pTK::Size& size, pTK::Point pos)
+{
+    const std::size_t i{((static_cast<std::size_t>(pos.y) * size.width) + static_cast<std::size_t>(pos.x)) * 4};
+    return {pixels[i], pixels[i + 1], pixels[i + 2], pixels[i + 3]};
+}
+
+TEST_CASE("Headless window")
+{
+    // Testing rendering without a display.
+
+    pTK::WindowInfo info{};
+    info.backend = pTK::WindowInfo::Backend::Headless;
+    pTK::Window window{"Headless", {64, 48}, info};
+
+    REQUIRE(window.getContext() != nullptr);
+    REQUIRE(window.getContentSize() == pTK::Size{64, 48});
+    REQUIRE(window.isHidden());
+
+    window.show();
+    REQUIRE(window.visible());
+
+    SECTION("Pixels")
+    {
+        window.setBackground(pTK::Color{0x00ff00ff});
+        auto widget = std::make_shared<ColorWidget>(pTK::Color{0xff0000ff});
+        window.add(widget);
+        window.renderFrame();
+
+        const std::vector<uint8_t> pixels{window.readPixels()};
+        REQUIRE(pixels.size() == 64 * 48 * 4);
+
+        const pTK::Point pos{widget->getPosition()};
+        REQUIRE(PixelAt(pixels, {64, 48}, {pos.x + 8, pos.y + 8}) == pTK::Color{0xff0000ff});
+
+        const pTK::Point outside{(pos.x > 0) ? 0 : 63, (pos.y > 0) ? 0 : 47};
+        REQUIRE(PixelAt(pixels, {64, 48}, outside) == pTK::Color{0x00ff00ff});
+    }
+
+    SECTION("PNG")
+    {
+        window.renderFrame();
+        const std::vector<uint8_t> png{window.encodePNG()};
+        REQUIRE(png.size() > 8);
+        REQUIRE(png[0] == 0x89);
+        REQUIRE(png[1] == 'P');
+        REQUIRE(png[2] == 'N');
+        REQUIRE(png[3] == 'G');
+    }
+
+    SECTION("Resize")
+    {
+        window.setSize({32, 32});
+        window.renderFrame();
+        REQUIRE(window.getContentSize() == pTK::Size{32, 32});
+        REQUIRE(window.readPixels().size() == 32 * 32 * 4);
+    }
+}
@@ -0,0 +1,124 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/util/InplaceFunction.hpp"
+
+// C++ Headers
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+
+TEST_CASE("Constructors")
+{
+    SECTION("Default")
+    {
+        pTK::InplaceFunction<int()> func{};
+        REQUIRE_FALSE(func);
+        REQUIRE_THROWS_AS(func(), std::bad_function_call);
+    }
+
+    SECTION("Lambda")
+    {
+        int value{2};
+        pTK::InplaceFunction<int(int)> func{[value](int x) { return value * x; }};
+        REQUIRE(func);
+        REQUIRE(func(3) == 6);
+    }
+
+    SECTION("Capacity")
+    {
+        std::array<char, 40> data{};
+        data[39] = 'a';
+        pTK::InplaceFunction<char()> func{[data]() { return data[39]; }};
+        REQUIRE(func() == 'a');
+    }
+
+    SECTION("std::function")
+    {
+        std::function<int()> inner{[]() { return 5; }};
+        pTK::InplaceFunction<int()> func{inner};
+        REQUIRE(func() == 5);
+    }
+
+    SECTION("Copy")
+    {
+        auto counter = std::make_shared<int>(0);
+        pTK::InplaceFunction<void()> f1{[counter]() { ++(*counter); }};
+        pTK::InplaceFunction<void()> f2{f1};
+        REQUIRE(counter.use_count() == 3);
+
+        f1();
+        f2();
+        REQUIRE(*counter == 2);
+    }
+
+    SECTION("Move")
+    {
+        auto counter = std::make_shared<int>(0);
+        pTK::InplaceFunction<void()> f1{[counter]() { ++(*counter); }};
+        pTK::InplaceFunction<void()> f2{std::move(f1)};
+        REQUIRE(counter.use_count() == 2);
+        REQUIRE_FALSE(f1);
+
+        f2();
+        REQUIRE(*counter == 1);
+    }
+}
+
+TEST_CASE("Assignment")
+{
+    auto counter = std::make_shared<int>(0);
+    pTK::InplaceFunction<void()> func{[counter]() { ++(*counter); }};
+
+    SECTION("Copy")
+    {
+        pTK::InplaceFunction<void()> other{};
+        other = func;
+        REQUIRE(counter.use_count() == 3);
+        other();
+        REQUIRE(*counter == 1);
+    }
+
+    SECTION("Move")
+    {
+        pTK::InplaceFunction<void()> other{[]() {}};
+        other = std::move(func);
+        REQUIRE(counter.use_count() == 2);
+        REQUIRE_FALSE(func);
+        other();
+        REQUIRE(*counter == 1);
+    }
+
+    SECTION("Reset")
+    {
+        func.reset();
+        REQUIRE_FALSE(func);
+        REQUIRE(counter.use_count() == 1);
+    }
+}
+
+TEST_CASE("Arguments")
+{
+    SECTION("Reference")
+    {
+        pTK::InplaceFunction<void(int&)> func{[](int& x) { x = 7; }};
+        int value{0};
+        func(value);
+        REQUIRE(value == 7);
+    }
+
+    SECTION("Const reference")
+    {
+        pTK::InplaceFunction<std::size_t(const std::string&)> func{[](const std::string& str) { return str.size(); }};
+        REQUIRE(func("pTK") == 3);
+    }
+
+    SECTION("Mutable")
+    {
+        pTK::InplaceFunction<int()> func{[count = 0]() mutable { return ++count; }};
+        REQUIRE(func() == 1);
+        REQUIRE(func() == 2);
+    }
+}
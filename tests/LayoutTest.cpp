@@ -0,0 +1,184 @@
+// Catch2 Headers
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/core/Widget.hpp"
+#include "ptk/widgets/HBox.hpp"
+#include "ptk/widgets/VBox.hpp"
+
+// C++ Headers
+#include <memory>
+#include <vector>
+
+static std::shared_ptr<pTK::Widget> MakeChild(const pTK::Size& min, const pTK::Size& max)
+{
+    auto child = std::make_shared<pTK::Widget>();
+    child->setSizePolicy(pTK::SizePolicy::Type::Expanding);
+    child->setLimits(min, max);
+    return child;
+}
+
+// Widget with a height that depends on the width, such as wrapped text.
+class WrappingWidget : public pTK::Widget
+{
+private:
+    void onSizeChange(const pTK::Size& size) override
+    {
+        if (size.width > 0)
+        {
+            const pTK::Size::value_type height{1000 / size.width};
+            setLimits({10, height}, {size.width, height});
+        }
+        update();
+    }
+};
+
+TEST_CASE("Distribution")
+{
+    // Testing how space is distributed between children.
+
+    SECTION("Water-filling")
+    {
+        pTK::VBox box{};
+        auto a = MakeChild({10, 10}, {100, 50});
+        auto b = MakeChild({10, 20}, {100, 25});
+        auto c = MakeChild({10, 30}, pTK::Size::Max);
+        box.add(a);
+        box.add(b);
+        box.add(c);
+        box.setSize({100, 200});
+
+        // 140 to distribute, b can take 5 and a 40 more, the rest goes to c.
+        REQUIRE(a->getSize() == pTK::Size{100, 50});
+        REQUIRE(b->getSize() == pTK::Size{100, 25});
+        REQUIRE(c->getSize() == pTK::Size{100, 125});
+        REQUIRE(a->getPosition() == pTK::Point{0, 0});
+        REQUIRE(b->getPosition() == pTK::Point{0, 50});
+        REQUIRE(c->getPosition() == pTK::Point{0, 75});
+    }
+
+    SECTION("Uneven")
+    {
+        pTK::HBox box{};
+        std::vector<std::shared_ptr<pTK::Widget>> children{};
+        for (int i{0}; i < 3; ++i)
+        {
+            children.push_back(MakeChild({0, 10}, pTK::Size::Max));
+            box.add(children.back());
+        }
+        box.setSize({100, 10});
+
+        // Remainder is given to the first children.
+        REQUIRE(children[0]->getSize().width == 34);
+        REQUIRE(children[1]->getSize().width == 33);
+        REQUIRE(children[2]->getSize().width == 33);
+        REQUIRE(children[2]->getPosition().x == 67);
+    }
+
+    SECTION("Reverse ordering")
+    {
+        pTK::VBox box{pTK::BoxLayout::Direction::BottomToTop};
+        auto a = MakeChild({10, 10}, {10, 10});
+        auto b = MakeChild({10, 20}, {10, 20});
+        box.add(a);
+        box.add(b);
+        box.setSize({10, 30});
+
+        // Each child keeps its own size, b is placed first.
+        REQUIRE(a->getSize() == pTK::Size{10, 10});
+        REQUIRE(b->getSize() == pTK::Size{10, 20});
+        REQUIRE(b->getPosition() == pTK::Point{0, 0});
+        REQUIRE(a->getPosition() == pTK::Point{0, 20});
+    }
+}
+
+TEST_CASE("Limit cache")
+{
+    // Testing that changed limits are picked up.
+
+    pTK::VBox box{};
+    auto a = MakeChild({10, 10}, {100, 10});
+    auto b = MakeChild({10, 10}, {100, 10});
+    box.add(a);
+    box.add(b);
+    box.setSize({100, 100});
+    REQUIRE(b->getPosition().y > 10);
+
+    SECTION("Max size")
+    {
+        a->setMaxSize({100, 60});
+        REQUIRE(a->getSize().height == 60);
+        REQUIRE(b->getPosition().y >= 60);
+    }
+
+    SECTION("Margin")
+    {
+        a->setMarginTop(5);
+        REQUIRE(a->getPosition().y >= 5);
+        REQUIRE(b->getPosition().y >= 15);
+    }
+
+    SECTION("Changed when resized")
+    {
+        auto c = std::make_shared<WrappingWidget>();
+        c->setSizePolicy(pTK::SizePolicy::Type::Expanding);
+        auto d = MakeChild({10, 10}, {100, 10});
+        box.add(c);
+        box.add(d);
+
+        // Layout with the limits c has after the resize.
+        auto expected = [&box, &c]() {
+            pTK::VBox other{};
+            other.add(MakeChild({10, 10}, {100, 10}));
+            other.add(MakeChild({10, 10}, {100, 10}));
+            other.add(MakeChild(c->getMinSize(), c->getMaxSize()));
+            auto last = MakeChild({10, 10}, {100, 10});
+            other.add(last);
+            other.setSize(box.getSize());
+            return last->getPosition();
+        };
+
+        box.setSize({50, 100});
+        REQUIRE(c->getMinSize().height == 20);
+        REQUIRE(d->getPosition() == expected());
+
+        box.setSize({20, 100});
+        REQUIRE(c->getMinSize().height == 50);
+        REQUIRE(d->getPosition() == expected());
+    }
+
+    SECTION("Removed")
+    {
+        box.remove(a);
+        b->setMaxSize({100, 20});
+        REQUIRE(b->getSize().height == 20);
+        REQUIRE(box.count() == 1);
+    }
+}
+
+TEST_CASE("Large layout")
+{
+    // Testing resizing a layout with many children.
+
+    constexpr int count{10000};
+    pTK::VBox box{};
+    {
+        pTK::WidgetContainer::BatchUpdate batch{box};
+        for (int i{0}; i < count; ++i)
+            box.add(MakeChild({10, static_cast<pTK::Size::value_type>(1 + (i % 3))},
+                              {100, static_cast<pTK::Size::value_type>(10 + (i % 7))}));
+    }
+
+    box.setSize({100, 100000});
+    REQUIRE(box.at(0)->getSize().height == 10);
+    REQUIRE(box.at(count - 1)->getPosition().y > box.at(count - 2)->getPosition().y);
+
+    pTK::Size::value_type height{80000};
+    BENCHMARK("Resize (10k children)")
+    {
+        height = (height == 80000) ? 90000 : 80000;
+        box.setSize({100, height});
+        return box.at(count - 1)->getPosition().y;
+    };
+}
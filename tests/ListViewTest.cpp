@@ -0,0 +1,179 @@
+// Catch2 Headers
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/events/MouseEvent.hpp"
+#include "ptk/widgets/ListView.hpp"
+
+// C++ Headers
+#include <memory>
+#include <string>
+
+struct RowStats
+{
+    std::size_t created{0};
+    std::size_t bound{0};
+    std::string hovered{};
+};
+
+static pTK::ListView::DataSource MakeSource(std::size_t rows, RowStats& stats)
+{
+    pTK::ListView::DataSource source{};
+    source.count = [rows]() { return rows; };
+    source.create = [&stats]() {
+        ++stats.created;
+        auto widget = std::make_shared<pTK::Widget>();
+        widget->setMaxSize(pTK::Size::Max);
+        widget->addListener<pTK::MotionEvent>([&stats, ptr = widget.get()](const pTK::MotionEvent&) {
+            stats.hovered = ptr->getName();
+            return false;
+        });
+        return widget;
+    };
+    source.bind = [&stats](pTK::Widget& widget, std::size_t index) {
+        ++stats.bound;
+        widget.setName("row " + std::to_string(index));
+    };
+    return source;
+}
+
+TEST_CASE("Pool")
+{
+    // Testing that only the visible rows are created.
+
+    SECTION("Independent of row count")
+    {
+        RowStats small{};
+        pTK::ListView smallList{};
+        smallList.setRowHeight(20);
+        smallList.setSize({200, 400});
+        smallList.setDataSource(MakeSource(100, small));
+
+        RowStats large{};
+        pTK::ListView largeList{};
+        largeList.setRowHeight(20);
+        largeList.setSize({200, 400});
+        largeList.setDataSource(MakeSource(10000000, large));
+
+        REQUIRE(smallList.rowCount() == 100);
+        REQUIRE(largeList.rowCount() == 10000000);
+        REQUIRE(smallList.count() == 22);
+        REQUIRE(largeList.count() == 22);
+        REQUIRE(large.created == 22);
+        REQUIRE(large.bound == 22);
+        REQUIRE(largeList.visibleRowCount() == 20);
+    }
+
+    SECTION("Fewer rows than visible")
+    {
+        RowStats stats{};
+        pTK::ListView list{};
+        list.setRowHeight(20);
+        list.setSize({200, 400});
+        list.setDataSource(MakeSource(3, stats));
+
+        REQUIRE(list.count() == 3);
+        REQUIRE(list.visibleRowCount() == 3);
+        REQUIRE(list.getScrollOffset() == 0);
+
+        list.setScrollOffset(100);
+        REQUIRE(list.getScrollOffset() == 0);
+    }
+
+    SECTION("Resize")
+    {
+        RowStats stats{};
+        pTK::ListView list{};
+        list.setRowHeight(20);
+        list.setSize({200, 400});
+        list.setDataSource(MakeSource(1000, stats));
+
+        list.setSize({200, 200});
+        REQUIRE(list.count() == 12);
+        REQUIRE(list.at(0)->getSize() == pTK::Size{200, 20});
+    }
+}
+
+TEST_CASE("Scrolling")
+{
+    // Testing that rows are rebound and positioned when scrolling.
+
+    RowStats stats{};
+    pTK::ListView list{};
+    list.setRowHeight(20);
+    list.setSize({200, 400});
+    list.setDataSource(MakeSource(10000000, stats));
+
+    SECTION("Offset")
+    {
+        stats.bound = 0;
+        list.setScrollOffset(30);
+
+        // Row 0 scrolled out, row 1 partially visible and row 22 is new.
+        REQUIRE(list.firstVisibleRow() == 1);
+        REQUIRE(list.visibleRowCount() == 21);
+        REQUIRE(stats.bound == 1);
+
+        const auto row = list.at(1 % list.count());
+        REQUIRE(row->getName() == "row 1");
+        REQUIRE(row->getPosition() == pTK::Point{0, -10});
+    }
+
+    SECTION("Clamped")
+    {
+        list.setScrollOffset(UINT64_MAX);
+        REQUIRE(list.getScrollOffset() == (10000000ULL * 20) - 400);
+        REQUIRE(list.firstVisibleRow() == 10000000 - 20);
+        REQUIRE(list.visibleRowCount() == 20);
+    }
+
+    SECTION("Scroll to row")
+    {
+        list.scrollToRow(5000000);
+        REQUIRE(list.getScrollOffset() == (5000001ULL * 20) - 400);
+
+        list.scrollToRow(10);
+        REQUIRE(list.getScrollOffset() == 200);
+        REQUIRE(list.firstVisibleRow() == 10);
+    }
+
+    SECTION("ScrollEvent")
+    {
+        list.setScrollStep(20.0f);
+        list.handleEvent<pTK::ScrollEvent>(pTK::ScrollEvent{{0.0f, -3.0f}});
+        REQUIRE(list.getScrollOffset() == 60);
+
+        list.handleEvent<pTK::ScrollEvent>(pTK::ScrollEvent{{0.0f, 10.0f}});
+        REQUIRE(list.getScrollOffset() == 0);
+    }
+
+    SECTION("Hit-testing")
+    {
+        list.setScrollOffset(1000000);
+        list.handleEvent<pTK::MotionEvent>(pTK::MotionEvent{{50, 45}});
+        REQUIRE(stats.hovered == "row 50002");
+        REQUIRE(list.rowOf(list.at(50002 % list.count()).get()) == 50002);
+    }
+}
+
+TEST_CASE("Large list")
+{
+    // Testing scrolling through 10 million rows.
+
+    RowStats stats{};
+    pTK::ListView list{};
+    list.setRowHeight(20);
+    list.setSize({200, 1000});
+    list.setDataSource(MakeSource(10000000, stats));
+
+    uint64_t offset{0};
+    BENCHMARK("Scroll (10M rows)")
+    {
+        offset = (offset + 997) % (10000000ULL * 20);
+        list.setScrollOffset(offset);
+        return list.firstVisibleRow();
+    };
+
+    REQUIRE(stats.created == 52);
+}
@@ -0,0 +1,105 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// Zones are compiled out otherwise.
+#ifndef PTK_PROFILE
+    #define PTK_PROFILE
+#endif
+
+// pTK Headers
+#include "ptk/core/Profiler.hpp"
+
+// C++ Headers
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace
+{
+    struct ProfiledType
+    {};
+} // namespace
+
+static std::string ChromeTrace()
+{
+    std::ostringstream stream{};
+    pTK::Profiler::WriteChromeTrace(stream);
+    return stream.str();
+}
+
+static std::size_t Count(const std::string& str, const std::string& value)
+{
+    std::size_t count{0};
+    for (std::size_t pos{str.find(value)}; pos != std::string::npos; pos = str.find(value, pos + value.size()))
+        ++count;
+    return count;
+}
+
+TEST_CASE("Zones")
+{
+    // Testing recording and exporting zones.
+
+    pTK::Profiler::Clear();
+
+    SECTION("Scoped")
+    {
+        {
+            PTK_PROFILE_ZONE("outer");
+            {
+                PTK_PROFILE_ZONE("inner \"quoted\"");
+            }
+        }
+
+        const std::string trace{ChromeTrace()};
+        REQUIRE(trace.rfind("{\"traceEvents\":[", 0) == 0);
+        REQUIRE(Count(trace, "\"name\":\"outer\"") == 1);
+        REQUIRE(Count(trace, "\"name\":\"inner \\\"quoted\\\"\"") == 1);
+        REQUIRE(Count(trace, "\"ph\":\"X\"") == 2);
+    }
+
+    SECTION("Type")
+    {
+        {
+            PTK_PROFILE_ZONE_TYPE(typeid(ProfiledType));
+        }
+
+        REQUIRE(Count(ChromeTrace(), "ProfiledType") == 1);
+    }
+
+    SECTION("Record")
+    {
+        pTK::Profiler::Record("manual", 1000, 3500);
+        REQUIRE(Count(ChromeTrace(), "\"name\":\"manual\",\"cat\":\"ptk\",\"ph\":\"X\",\"ts\":1.000,\"dur\":2.500") ==
+                1);
+    }
+
+    SECTION("Clear")
+    {
+        pTK::Profiler::Record("cleared", 0, 1);
+        pTK::Profiler::Clear();
+        REQUIRE(Count(ChromeTrace(), "cleared") == 0);
+    }
+
+    SECTION("Overwrite")
+    {
+        // Only the newest zones are kept.
+        for (std::size_t i{0}; i < pTK::Profiler::BufferSize; ++i)
+            pTK::Profiler::Record("old", 0, 1);
+        pTK::Profiler::Record("new", 0, 1);
+
+        const std::string trace{ChromeTrace()};
+        REQUIRE(Count(trace, "\"name\":\"old\"") == pTK::Profiler::BufferSize - 1);
+        REQUIRE(Count(trace, "\"name\":\"new\"") == 1);
+    }
+
+    SECTION("Threads")
+    {
+        std::thread thread{[] {
+            PTK_PROFILE_ZONE("thread");
+        }};
+        thread.join();
+
+        // Zones are kept after the thread has exited.
+        REQUIRE(Count(ChromeTrace(), "\"name\":\"thread\"") == 1);
+    }
+}
@@ -0,0 +1,130 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/util/Rect.hpp"
+
+TEST_CASE("Constructors")
+{
+    // Testing Constructors with correct data.
+
+    SECTION("Rect()")
+    {
+        constexpr pTK::Rect rect{};
+
+        REQUIRE(rect.pos == pTK::Point{0, 0});
+        REQUIRE(rect.size == pTK::Size{0, 0});
+        REQUIRE(rect.isEmpty());
+    }
+
+    SECTION("Rect(const Point& pos, const Size& size)")
+    {
+        constexpr pTK::Rect rect{{10, 20}, {30, 40}};
+
+        REQUIRE(rect.pos == pTK::Point{10, 20});
+        REQUIRE(rect.size == pTK::Size{30, 40});
+        REQUIRE(rect.right() == 40);
+        REQUIRE(rect.bottom() == 60);
+        REQUIRE_FALSE(rect.isEmpty());
+    }
+
+    SECTION("Overflow")
+    {
+        const pTK::Rect rect{{10, 20}, pTK::Size::Max};
+
+        REQUIRE(rect.right() == std::numeric_limits<pTK::Point::value_type>::max());
+        REQUIRE(rect.bottom() == std::numeric_limits<pTK::Point::value_type>::max());
+    }
+}
+
+TEST_CASE("Contains")
+{
+    // Testing contains (half-open).
+    const pTK::Rect rect{{10, 10}, {10, 10}};
+
+    SECTION("Point")
+    {
+        REQUIRE(rect.contains(pTK::Point{10, 10}));
+        REQUIRE(rect.contains(pTK::Point{19, 19}));
+        REQUIRE_FALSE(rect.contains(pTK::Point{20, 20}));
+        REQUIRE_FALSE(rect.contains(pTK::Point{9, 15}));
+    }
+
+    SECTION("Rect")
+    {
+        REQUIRE(rect.contains(rect));
+        REQUIRE(rect.contains(pTK::Rect{{12, 12}, {2, 2}}));
+        REQUIRE_FALSE(rect.contains(pTK::Rect{{12, 12}, {10, 2}}));
+        REQUIRE_FALSE(rect.contains(pTK::Rect{{12, 12}, {0, 0}}));
+    }
+}
+
+TEST_CASE("Intersection")
+{
+    // Testing intersects and intersected.
+    const pTK::Rect rect{{10, 10}, {10, 10}};
+
+    SECTION("Overlapping")
+    {
+        const pTK::Rect other{{15, 5}, {10, 10}};
+
+        REQUIRE(rect.intersects(other));
+        REQUIRE(other.intersects(rect));
+        REQUIRE(rect.intersected(other) == pTK::Rect{{15, 10}, {5, 5}});
+    }
+
+    SECTION("Touching")
+    {
+        const pTK::Rect other{{20, 10}, {10, 10}};
+
+        REQUIRE_FALSE(rect.intersects(other));
+        REQUIRE(rect.intersected(other).isEmpty());
+    }
+
+    SECTION("Empty")
+    {
+        const pTK::Rect other{{12, 12}, {0, 5}};
+
+        REQUIRE_FALSE(rect.intersects(other));
+        REQUIRE_FALSE(other.intersects(rect));
+    }
+}
+
+TEST_CASE("Union")
+{
+    // Testing united.
+    const pTK::Rect rect{{10, 10}, {10, 10}};
+
+    SECTION("Separate")
+    {
+        const pTK::Rect other{{30, 0}, {5, 5}};
+
+        REQUIRE(rect.united(other) == pTK::Rect{{10, 0}, {25, 20}});
+    }
+
+    SECTION("Empty")
+    {
+        REQUIRE(rect.united(pTK::Rect{}) == rect);
+        REQUIRE(pTK::Rect{}.united(rect) == rect);
+    }
+}
+
+TEST_CASE("Comparison")
+{
+    // Testing Rect Comparison.
+    const pTK::Rect r1{{10, 10}, {10, 10}};
+    const pTK::Rect r2{{10, 10}, {10, 10}};
+    const pTK::Rect r3{{10, 10}, {11, 10}};
+
+    SECTION("Equal")
+    {
+        REQUIRE(r1 == r2);
+        REQUIRE_FALSE(r1 == r3);
+    }
+
+    SECTION("Not Equal")
+    {
+        REQUIRE(r1 != r3);
+        REQUIRE_FALSE(r1 != r2);
+    }
+}
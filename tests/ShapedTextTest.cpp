@@ -0,0 +1,100 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/widgets/Label.hpp"
+#include "ptk/widgets/TextField.hpp"
+
+// Skia Headers
+PTK_DISABLE_WARN_BEGIN()
+#include "include/core/SkCanvas.h"
+#include "include/core/SkSurface.h"
+PTK_DISABLE_WARN_END()
+
+// C++ Headers
+#include <string>
+
+TEST_CASE("Constructors")
+{
+    // Testing Constructors.
+
+    SECTION("ShapedText()")
+    {
+        pTK::ShapedText text{};
+
+        REQUIRE(text.empty());
+        REQUIRE(text.blob().get() == nullptr);
+        REQUIRE(text.advance() == 0.0f);
+    }
+
+    SECTION("ShapedText(const void* text, std::size_t byteLength, SkTextEncoding encoding, const SkFont& font)")
+    {
+        const std::string str{"  Text"};
+        const pTK::Text font{};
+        pTK::ShapedText text{str.c_str(), str.size(), SkTextEncoding::kUTF8, font.skFont()};
+
+        REQUIRE_FALSE(text.empty());
+        REQUIRE(text.advance() == font.skFont().measureText(str.c_str(), str.size(), SkTextEncoding::kUTF8));
+        REQUIRE(text.offset().y == font.capHeight());
+
+        pTK::ShapedText empty{str.c_str(), 0, SkTextEncoding::kUTF8, font.skFont()};
+        REQUIRE(empty.empty());
+    }
+}
+
+TEST_CASE("Cache")
+{
+    // Testing when the shaped text is rebuilt.
+
+    sk_sp<SkSurface> surface{SkSurface::MakeRasterN32Premul(200, 200)};
+    pTK::Canvas canvas{surface->getCanvas()};
+
+    SECTION("Label")
+    {
+        pTK::Label label{};
+        REQUIRE(label.shapedText().empty());
+
+        label.setText("Hello");
+        const SkTextBlob* blob{label.shapedText().blob().get()};
+        REQUIRE(blob != nullptr);
+
+        // Drawing reuses the blob.
+        label.onDraw(&canvas);
+        label.onDraw(&canvas);
+        REQUIRE(label.shapedText().blob().get() == blob);
+
+        label.setFontSize(label.getFontSize() + 4);
+        REQUIRE(label.shapedText().blob().get() != blob);
+
+        // Fallback and default typefaces are shaped again as well.
+        sk_sp<SkTextBlob> previous{label.shapedText().blob()};
+        REQUIRE_FALSE(label.setFontFromFile("missing-font-file.ttf"));
+        REQUIRE(label.shapedText().blob().get() != previous.get());
+
+        previous = label.shapedText().blob();
+        static_cast<void>(label.setFontFamily(""));
+        REQUIRE(label.shapedText().blob().get() != previous.get());
+
+        label.setText("");
+        REQUIRE(label.shapedText().empty());
+    }
+
+    SECTION("TextField")
+    {
+        pTK::TextField field{};
+        field.setPlaceholderText("Placeholder");
+        field.setText("Text");
+
+        // The visible text is shaped when drawn.
+        field.onDraw(&canvas);
+        const SkTextBlob* blob{field.shapedText().blob().get()};
+        REQUIRE(blob != nullptr);
+
+        field.onDraw(&canvas);
+        REQUIRE(field.shapedText().blob().get() == blob);
+
+        field.setText("Other");
+        field.onDraw(&canvas);
+        REQUIRE(field.shapedText().blob().get() != blob);
+    }
+}
@@ -0,0 +1,189 @@
+// Catch2 Headers
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/core/SpatialIndex.hpp"
+#include "ptk/core/WidgetContainer.hpp"
+#include "ptk/events/MouseEvent.hpp"
+
+// C++ Headers
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+static std::vector<pTK::Rect> MakeRow(std::size_t count, pTK::Size::value_type width)
+{
+    std::vector<pTK::Rect> rects{};
+    for (std::size_t i{0}; i < count; ++i)
+        rects.push_back({{static_cast<pTK::Point::value_type>(i * width), 0}, {width, 20}});
+    return rects;
+}
+
+static std::size_t LinearFind(const std::vector<pTK::Rect>& rects, const pTK::Point& pos)
+{
+    for (std::size_t i{0}; i < rects.size(); ++i)
+        if (rects[i].contains(pos))
+            return i;
+    return pTK::SpatialIndex::npos;
+}
+
+TEST_CASE("Axis")
+{
+    // Testing Horizontal and Vertical index.
+
+    SECTION("Row")
+    {
+        pTK::SpatialIndex index{pTK::SpatialIndex::Type::Horizontal};
+        index.build(MakeRow(100, 10));
+
+        REQUIRE(index.valid());
+        REQUIRE(index.find({0, 0}) == 0);
+        REQUIRE(index.find({9, 19}) == 0);
+        REQUIRE(index.find({10, 5}) == 1);
+        REQUIRE(index.find({995, 5}) == 99);
+        REQUIRE(index.find({1000, 5}) == pTK::SpatialIndex::npos);
+        REQUIRE(index.find({-1, 5}) == pTK::SpatialIndex::npos);
+        REQUIRE(index.find({50, 20}) == pTK::SpatialIndex::npos);
+    }
+
+    SECTION("Column")
+    {
+        std::vector<pTK::Rect> rects{};
+        for (int i{0}; i < 10; ++i)
+            rects.push_back({{0, i * 30}, {50, 20}});
+
+        pTK::SpatialIndex index{pTK::SpatialIndex::Type::Vertical};
+        index.build(rects);
+
+        REQUIRE(index.find({10, 35}) == 1);
+        REQUIRE(index.find({10, 25}) == pTK::SpatialIndex::npos); // Gap between.
+        REQUIRE(index.find({60, 35}) == pTK::SpatialIndex::npos);
+    }
+
+    SECTION("Unsorted and overlapping")
+    {
+        const std::vector<pTK::Rect> rects{
+            {{50, 0}, {10, 10}}, {{0, 0}, {100, 10}}, {{20, 0}, {10, 10}}, {{0, 0}, {0, 0}}};
+
+        pTK::SpatialIndex index{pTK::SpatialIndex::Type::Horizontal};
+        index.build(rects);
+
+        // Lowest index wins.
+        REQUIRE(index.find({55, 5}) == 0);
+        REQUIRE(index.find({25, 5}) == 1);
+        REQUIRE(index.find({5, 5}) == 1);
+    }
+}
+
+TEST_CASE("Grid")
+{
+    // Testing Grid index against a linear search.
+
+    std::srand(1234);
+    std::vector<pTK::Rect> rects{};
+    for (int i{0}; i < 500; ++i)
+    {
+        const pTK::Point pos{std::rand() % 1000, std::rand() % 1000};
+        const pTK::Size size{static_cast<pTK::Size::value_type>(std::rand() % 100),
+                             static_cast<pTK::Size::value_type>(std::rand() % 100)};
+        rects.push_back({pos, size});
+    }
+
+    pTK::SpatialIndex index{pTK::SpatialIndex::Type::Grid};
+    index.build(rects);
+
+    for (int i{0}; i < 5000; ++i)
+    {
+        const pTK::Point pos{(std::rand() % 1200) - 100, (std::rand() % 1200) - 100};
+        REQUIRE(index.find(pos) == LinearFind(rects, pos));
+    }
+}
+
+TEST_CASE("Invalidation")
+{
+    // Testing type changes and invalidation.
+
+    pTK::SpatialIndex index{};
+    REQUIRE(index.type() == pTK::SpatialIndex::Type::None);
+    REQUIRE_FALSE(index.valid());
+
+    index.setType(pTK::SpatialIndex::Type::Grid);
+    index.build(MakeRow(10, 10));
+    REQUIRE(index.valid());
+
+    index.setType(pTK::SpatialIndex::Type::Grid);
+    REQUIRE(index.valid());
+
+    index.setType(pTK::SpatialIndex::Type::Horizontal);
+    REQUIRE_FALSE(index.valid());
+
+    index.build(MakeRow(10, 10));
+    index.invalidate();
+    REQUIRE_FALSE(index.valid());
+}
+
+class HoverContainer : public pTK::WidgetContainer
+{
+public:
+    explicit HoverContainer(std::size_t count)
+    {
+        setSize({100, static_cast<pTK::Size::value_type>(count * 10)});
+        for (std::size_t i{0}; i < count; ++i)
+        {
+            auto child = std::make_shared<pTK::Widget>();
+            child->setSize({100, 10});
+            add(child);
+            child->setPosHint({0, static_cast<pTK::Point::value_type>(i * 10)});
+            child->addListener<pTK::MotionEvent>([this, i](const pTK::MotionEvent&) {
+                hovered = i;
+                return false;
+            });
+        }
+    }
+
+    std::size_t hovered{0};
+};
+
+TEST_CASE("WidgetContainer")
+{
+    // Testing hit-testing with 10k children.
+
+    constexpr std::size_t count{10000};
+    HoverContainer linear{count};
+    HoverContainer indexed{count};
+    indexed.setSpatialIndexType(pTK::SpatialIndex::Type::Vertical);
+
+    SECTION("Same result")
+    {
+        for (std::size_t i{0}; i < count; i += 97)
+        {
+            const pTK::MotionEvent evt{{50, static_cast<pTK::Point::value_type>((i * 10) + 5)}};
+            linear.handleEvent<pTK::MotionEvent>(evt);
+            indexed.handleEvent<pTK::MotionEvent>(evt);
+            REQUIRE(linear.hovered == i);
+            REQUIRE(indexed.hovered == i);
+        }
+    }
+
+    SECTION("Moved child")
+    {
+        indexed.at(0)->setPosHint({0, static_cast<pTK::Point::value_type>(count * 10)});
+        indexed.handleEvent<pTK::MotionEvent>(pTK::MotionEvent{{50, static_cast<pTK::Point::value_type>(count * 10)}});
+        REQUIRE(indexed.hovered == 0);
+    }
+
+    BENCHMARK("Linear hit-test (10k children)")
+    {
+        for (pTK::Point::value_type y{0}; y < 100000; y += 1000)
+            linear.handleEvent<pTK::MotionEvent>(pTK::MotionEvent{{50, y}});
+        return linear.hovered;
+    };
+
+    BENCHMARK("Indexed hit-test (10k children)")
+    {
+        for (pTK::Point::value_type y{0}; y < 100000; y += 1000)
+            indexed.handleEvent<pTK::MotionEvent>(pTK::MotionEvent{{50, y}});
+        return indexed.hovered;
+    };
+}
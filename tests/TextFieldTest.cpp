@@ -0,0 +1,167 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/events/KeyEvent.hpp"
+#include "ptk/widgets/TextField.hpp"
+
+// Skia Headers
+PTK_DISABLE_WARN_BEGIN()
+#include "include/core/SkCanvas.h"
+#include "include/core/SkSurface.h"
+PTK_DISABLE_WARN_END()
+
+// C++ Headers
+#include <cmath>
+#include <cstring>
+#include <string>
+
+static void Press(pTK::TextField& field, pTK::KeyCode key)
+{
+    field.handleEvent<pTK::KeyEvent>({pTK::Event::Type::KeyPressed, key, 0});
+}
+
+static void Type(pTK::TextField& field, const std::string& str)
+{
+    field.handleEvent<pTK::InputEvent>({str.data(), str.size()});
+}
+
+static pTK::Size::value_type TextWidth(const pTK::TextField& field)
+{
+    const std::string& text{field.getText()};
+    const float advance{field.skFont().measureText(text.data(), text.size(), SkTextEncoding::kUTF8)};
+    return static_cast<pTK::Size::value_type>(std::ceil(advance)) + 1;
+}
+
+TEST_CASE("Editing")
+{
+    // Testing keyboard editing at the cursor.
+
+    pTK::TextField field{};
+    field.setText("Hello");
+
+    SECTION("Type")
+    {
+        Press(field, pTK::Key::End);
+        Type(field, " World");
+        REQUIRE(field.getText() == "Hello World");
+
+        Press(field, pTK::Key::Home);
+        Type(field, ">");
+        REQUIRE(field.getText() == ">Hello World");
+        REQUIRE(field.getMinSize().width == TextWidth(field));
+    }
+
+    SECTION("Remove")
+    {
+        Press(field, pTK::Key::End);
+        Press(field, pTK::Key::Backspace);
+        REQUIRE(field.getText() == "Hell");
+
+        Press(field, pTK::Key::Home);
+        Press(field, pTK::Key::Delete);
+        REQUIRE(field.getText() == "ell");
+
+        Press(field, pTK::Key::Right);
+        Press(field, pTK::Key::Backspace);
+        REQUIRE(field.getText() == "ll");
+
+        // Nothing to remove before the start.
+        Press(field, pTK::Key::Home);
+        Press(field, pTK::Key::Backspace);
+        REQUIRE(field.getText() == "ll");
+        REQUIRE(field.getMinSize().width == TextWidth(field));
+    }
+
+    SECTION("UTF-8")
+    {
+        // Multi-byte chars are removed and skipped as a whole.
+        field.setText("a\xC3\xA9z");
+        Press(field, pTK::Key::End);
+        Press(field, pTK::Key::Left);
+        Press(field, pTK::Key::Backspace);
+        REQUIRE(field.getText() == "az");
+
+        field.setText("a\xC3\xA9z");
+        Press(field, pTK::Key::Home);
+        Type(field, "\xE2\x82\xAC\xF0\x9F\x98\x80");
+        REQUIRE(field.getText() == "\xE2\x82\xAC\xF0\x9F\x98\x80" "a\xC3\xA9z");
+
+        const pTK::InputEvent::data_type codepoints[]{0x20AC, 0xD800, 0x110000};
+        field.handleEvent<pTK::InputEvent>({codepoints, 3});
+        REQUIRE(field.getText() == "\xE2\x82\xAC\xF0\x9F\x98\x80\xE2\x82\xAC\xEF\xBF\xBD\xEF\xBF\xBD" "a\xC3\xA9z");
+
+        field.setText("a\xC3\xA9z");
+        Press(field, pTK::Key::Home);
+        Press(field, pTK::Key::Right);
+        Press(field, pTK::Key::Delete);
+        REQUIRE(field.getText() == "az");
+        REQUIRE(field.getMinSize().width == TextWidth(field));
+    }
+}
+
+TEST_CASE("Advances")
+{
+    // Testing that the advance of a char is on its first byte and that invalid bytes are measured as U+FFFD.
+
+    const SkFont font{};
+    auto measure = [&font](const char* str) { return font.measureText(str, std::strlen(str), SkTextEncoding::kUTF8); };
+
+    const std::string str{"a\xC3\xA9\x80z"};
+    float advances[5]{};
+    const float total{pTK::Text::MeasureAdvances(font, str.data(), str.size(), advances)};
+    REQUIRE(advances[0] == measure("a"));
+    REQUIRE(advances[1] == measure("\xC3\xA9"));
+    REQUIRE(advances[2] == 0.0f);
+    REQUIRE(advances[3] == measure("\xEF\xBF\xBD"));
+    REQUIRE(advances[3] > 0.0f);
+    REQUIRE(advances[4] == measure("z"));
+    REQUIRE(total == advances[0] + advances[1] + advances[3] + advances[4]);
+}
+
+TEST_CASE("Long text")
+{
+    // Testing editing and drawing of a 1 MB line.
+
+    sk_sp<SkSurface> surface{SkSurface::MakeRasterN32Premul(200, 40)};
+    pTK::Canvas canvas{surface->getCanvas()};
+
+    pTK::TextField field{};
+    field.setText(std::string(1 << 20, 'x'));
+    Press(field, pTK::Key::Home);
+    for (int i{0}; i < 100; ++i)
+        Press(field, pTK::Key::Right);
+
+    Type(field, "abc");
+    Press(field, pTK::Key::Backspace);
+    REQUIRE(field.getText().size() == (1 << 20) + 2);
+    REQUIRE(field.getText().compare(100, 3, "abx") == 0);
+
+    // Only the visible part is shaped.
+    field.onDraw(&canvas);
+    REQUIRE_FALSE(field.shapedText().empty());
+    REQUIRE(field.shapedText().advance() < 1000.0f);
+
+    // Scrolled, then edited before and after the visible part.
+    canvas.skCanvas->translate(-5000.0f, 0.0f);
+    field.onDraw(&canvas);
+    const float advance{field.shapedText().advance()};
+    REQUIRE(advance < 1000.0f);
+
+    Type(field, "def");
+    field.onDraw(&canvas);
+    REQUIRE(field.shapedText().advance() == advance);
+
+    Press(field, pTK::Key::End);
+    Press(field, pTK::Key::Backspace);
+    field.onDraw(&canvas);
+    REQUIRE(field.shapedText().advance() == advance);
+
+    // Scrolled back, same visible text as a field that has not been scrolled.
+    canvas.skCanvas->translate(4000.0f, 0.0f);
+    field.onDraw(&canvas);
+    pTK::TextField other{};
+    other.setText(field.getText());
+    other.onDraw(&canvas);
+    REQUIRE(field.shapedText().advance() == other.shapedText().advance());
+}
@@ -0,0 +1,127 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/core/TextLayout.hpp"
+#include "ptk/widgets/TextArea.hpp"
+
+// Skia Headers
+PTK_DISABLE_WARN_BEGIN()
+#include "include/core/SkCanvas.h"
+#include "include/core/SkSurface.h"
+PTK_DISABLE_WARN_END()
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+static std::vector<std::string> Lines(const pTK::TextLayout& layout)
+{
+    std::vector<std::string> lines{};
+    for (std::size_t i{0}; i < layout.lineCount(); ++i)
+    {
+        const pTK::TextLayout::Line line{layout.line(i)};
+        lines.push_back(layout.text().substr(line.start, line.end - line.start));
+    }
+    return lines;
+}
+
+static pTK::TextLayout MakeLayout(const std::string& text, float width)
+{
+    pTK::TextLayout layout{};
+    layout.setFont(SkFont{});
+    layout.setWidth(width);
+    layout.setText(text);
+    return layout;
+}
+
+TEST_CASE("Line breaking")
+{
+    // Testing breaking of lines at spaces and between chars.
+
+    const float charWidth{SkFont{}.measureText("x", 1, SkTextEncoding::kUTF8)};
+
+    SECTION("Paragraphs")
+    {
+        pTK::TextLayout layout{MakeLayout("first\r\n\nthird", 0.0f)};
+        REQUIRE(Lines(layout) == std::vector<std::string>{"first", "", "third"});
+        REQUIRE(layout.maxLineWidth() == 5 * charWidth);
+        REQUIRE(layout.height() == 3 * layout.lineHeight());
+    }
+
+    SECTION("Spaces")
+    {
+        pTK::TextLayout layout{MakeLayout("aaa bbb  ccc dd", 8 * charWidth)};
+        REQUIRE(Lines(layout) == std::vector<std::string>{"aaa bbb", "ccc dd"});
+        REQUIRE(layout.line(0).width == 7 * charWidth);
+        REQUIRE(layout.maxLineWidth() <= layout.width());
+    }
+
+    SECTION("Long words")
+    {
+        pTK::TextLayout layout{MakeLayout("ab abcdefgh", 3 * charWidth)};
+        REQUIRE(Lines(layout) == std::vector<std::string>{"ab", "abc", "def", "gh"});
+    }
+
+    SECTION("UTF-8")
+    {
+        // Multi-byte chars are not split.
+        pTK::TextLayout layout{MakeLayout("\xC3\xA9\xC3\xA9\xC3\xA9", 2 * charWidth)};
+        REQUIRE(Lines(layout) == std::vector<std::string>{"\xC3\xA9\xC3\xA9", "\xC3\xA9"});
+    }
+}
+
+TEST_CASE("Resize")
+{
+    // Testing that lines broken again at a new width matches a new layout.
+
+    const float charWidth{SkFont{}.measureText("x", 1, SkTextEncoding::kUTF8)};
+
+    std::string text{};
+    for (int i{0}; i < 200; ++i)
+        text += (i % 10 == 0) ? "a short line\n" : "some words that are wrapped when the width is small enough\n";
+
+    pTK::TextLayout layout{MakeLayout(text, 0.0f)};
+    REQUIRE(layout.lineCount() == 201);
+    REQUIRE(layout.brokenLines() == 0);
+
+    for (int chars : {40, 20, 7, 3, 25, 100, 59, 58})
+    {
+        const float width{static_cast<float>(chars) * charWidth};
+        layout.setWidth(width);
+        const pTK::TextLayout expected{MakeLayout(text, width)};
+        REQUIRE(Lines(layout) == Lines(expected));
+        REQUIRE(layout.maxLineWidth() == expected.maxLineWidth());
+    }
+
+    // Short lines that still fit are not broken again.
+    layout.setWidth(57 * charWidth);
+    REQUIRE(layout.lineCount() == 381);
+    REQUIRE(layout.brokenLines() == 360);
+    layout.setWidth(57.5f * charWidth);
+    REQUIRE(layout.brokenLines() == 0);
+}
+
+TEST_CASE("Visible lines")
+{
+    // Testing that only the lines inside the clip are shaped.
+
+    pTK::TextLayout layout{MakeLayout(std::string(99, '\n'), 0.0f)};
+    const float lineHeight{layout.lineHeight()};
+    REQUIRE(layout.linesBetween(0.0f, lineHeight) == std::pair<std::size_t, std::size_t>{0, 1});
+    REQUIRE(layout.linesBetween(lineHeight * 10.5f, lineHeight * 12.5f) == std::pair<std::size_t, std::size_t>{10, 13});
+    REQUIRE(layout.linesBetween(-lineHeight, lineHeight * 1000.0f) == std::pair<std::size_t, std::size_t>{0, 100});
+
+    std::string text{};
+    for (int i{0}; i < 100000; ++i)
+        text += "line " + std::to_string(i) + "\n";
+
+    pTK::TextArea area{};
+    area.setText(text);
+    REQUIRE(area.layout().lineCount() == 100001);
+    REQUIRE(area.getMinSize().height >= static_cast<pTK::Size::value_type>(area.layout().height()));
+
+    sk_sp<SkSurface> surface{SkSurface::MakeRasterN32Premul(200, 200)};
+    pTK::Canvas canvas{surface->getCanvas()};
+    area.onDraw(&canvas);
+}
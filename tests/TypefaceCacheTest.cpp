@@ -0,0 +1,79 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/core/Text.hpp"
+#include "ptk/core/TypefaceCache.hpp"
+
+// C++ Headers
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Lookup")
+{
+    // Testing that typefaces are loaded once.
+
+    pTK::TypefaceCache::Clear();
+
+    SECTION("FromName")
+    {
+        sk_sp<SkTypeface> first{pTK::TypefaceCache::FromName("")};
+        sk_sp<SkTypeface> second{pTK::TypefaceCache::FromName("")};
+        REQUIRE(first.get() == second.get());
+
+        pTK::TypefaceCache::Stats stats{pTK::TypefaceCache::GetStats()};
+        REQUIRE(stats.typefaces == 1);
+        REQUIRE(stats.misses == 1);
+        REQUIRE(stats.hits == 1);
+
+        // Other styles are other typefaces.
+        static_cast<void>(pTK::TypefaceCache::FromName("", SkFontStyle::Bold()));
+        REQUIRE(pTK::TypefaceCache::GetStats().typefaces == 2);
+    }
+
+    SECTION("FromFile")
+    {
+        // Failed loads are not cached.
+        REQUIRE(pTK::TypefaceCache::FromFile("does/not/exist.ttf").get() == nullptr);
+        REQUIRE(pTK::TypefaceCache::GetStats().typefaces == 0);
+    }
+
+    SECTION("Preload")
+    {
+        pTK::TypefaceCache::Preload({"", "Arial", "Arial"});
+
+        pTK::TypefaceCache::Stats stats{pTK::TypefaceCache::GetStats()};
+        REQUIRE(stats.typefaces == 2);
+        REQUIRE(stats.misses == 2);
+        REQUIRE(stats.hits == 1);
+    }
+
+    SECTION("Text")
+    {
+        std::vector<pTK::Text> texts(100);
+        for (pTK::Text& text : texts)
+            text.setFontFamily("Arial");
+
+        pTK::TypefaceCache::Stats stats{pTK::TypefaceCache::GetStats()};
+        REQUIRE(stats.typefaces == 1);
+        REQUIRE(stats.misses == 1);
+        REQUIRE(stats.hits == 99);
+    }
+
+    SECTION("Threads")
+    {
+        std::vector<std::thread> threads{};
+        for (int i{0}; i < 4; ++i)
+            threads.emplace_back([] {
+                for (int j{0}; j < 100; ++j)
+                    static_cast<void>(pTK::TypefaceCache::FromName("Arial"));
+            });
+        for (std::thread& thread : threads)
+            thread.join();
+
+        pTK::TypefaceCache::Stats stats{pTK::TypefaceCache::GetStats()};
+        REQUIRE(stats.misses == 1);
+        REQUIRE(stats.hits == 399);
+    }
+}
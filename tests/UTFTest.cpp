@@ -0,0 +1,100 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/util/UTF.hpp"
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+static std::vector<uint32_t> Decode(const std::string& str)
+{
+    std::vector<uint32_t> codepoints(str.size());
+    const pTK::UTF::DecodeResult result{
+        pTK::UTF::DecodeUTF8(str.data(), str.size(), codepoints.data(), codepoints.size())};
+    REQUIRE(result.read == str.size());
+    codepoints.resize(result.written);
+    return codepoints;
+}
+
+static std::string Encode(uint32_t cp)
+{
+    char buffer[4];
+    return {buffer, pTK::UTF::EncodeUTF8(cp, buffer)};
+}
+
+TEST_CASE("Decode UTF-8")
+{
+    // Testing decoding of valid UTF-8.
+
+    REQUIRE(Decode("").empty());
+    REQUIRE(Decode("abc") == std::vector<uint32_t>{'a', 'b', 'c'});
+    REQUIRE(Decode("\xC3\xA9") == std::vector<uint32_t>{0xE9});
+    REQUIRE(Decode("\xE2\x82\xAC") == std::vector<uint32_t>{0x20AC});
+    REQUIRE(Decode("\xF0\x9F\x98\x80") == std::vector<uint32_t>{0x1F600});
+    REQUIRE(Decode("\xF4\x8F\xBF\xBF") == std::vector<uint32_t>{0x10FFFF});
+}
+
+TEST_CASE("Decode invalid UTF-8")
+{
+    // Testing that each invalid sequence is decoded as one replacement char.
+
+    constexpr uint32_t r{pTK::UTF::ReplacementChar};
+
+    // Lone continuation byte and invalid lead bytes.
+    REQUIRE(Decode("a\x80z") == std::vector<uint32_t>{'a', r, 'z'});
+    REQUIRE(Decode("\xC0\xAF") == std::vector<uint32_t>{r, r});
+    REQUIRE(Decode("\xFF") == std::vector<uint32_t>{r});
+
+    // Overlong, surrogate and out of range.
+    REQUIRE(Decode("\xE0\x80\xAF") == std::vector<uint32_t>{r, r, r});
+    REQUIRE(Decode("\xED\xA0\x80") == std::vector<uint32_t>{r, r, r});
+    REQUIRE(Decode("\xF4\x90\x80\x80") == std::vector<uint32_t>{r, r, r, r});
+
+    // Truncated sequences.
+    REQUIRE(Decode("\xE2\x82z") == std::vector<uint32_t>{r, 'z'});
+    REQUIRE(Decode("\xF0\x9F\x98") == std::vector<uint32_t>{r});
+}
+
+TEST_CASE("Decode capacity")
+{
+    // Testing that decoding stops at capacity.
+
+    const std::string str{"a\xC3\xA9z"};
+    uint32_t codepoints[2];
+    const pTK::UTF::DecodeResult result{pTK::UTF::DecodeUTF8(str.data(), str.size(), codepoints, 2)};
+    REQUIRE(result.read == 3);
+    REQUIRE(result.written == 2);
+    REQUIRE(codepoints[1] == 0xE9);
+}
+
+TEST_CASE("Decode UTF-16")
+{
+    // Testing decoding of surrogate pairs.
+
+    const char16_t str[]{u'a', 0xD83D, 0xDE00, 0xDE00, 0xD83D};
+    uint32_t codepoints[5];
+    const pTK::UTF::DecodeResult result{pTK::UTF::DecodeUTF16(str, 5, codepoints, 5)};
+    REQUIRE(result.read == 5);
+    REQUIRE(result.written == 4);
+    REQUIRE(codepoints[0] == 'a');
+    REQUIRE(codepoints[1] == 0x1F600);
+    REQUIRE(codepoints[2] == pTK::UTF::ReplacementChar);
+    REQUIRE(codepoints[3] == pTK::UTF::ReplacementChar);
+}
+
+TEST_CASE("Encode UTF-8")
+{
+    // Testing encoding and round trip.
+
+    REQUIRE(Encode('a') == "a");
+    REQUIRE(Encode(0xE9) == "\xC3\xA9");
+    REQUIRE(Encode(0x20AC) == "\xE2\x82\xAC");
+    REQUIRE(Encode(0x1F600) == "\xF0\x9F\x98\x80");
+    REQUIRE(Encode(0xD800) == "\xEF\xBF\xBD");
+    REQUIRE(Encode(0x110000) == "\xEF\xBF\xBD");
+
+    for (uint32_t cp : {0x7Fu, 0x80u, 0x7FFu, 0x800u, 0xFFFFu, 0x10000u, 0x10FFFFu})
+        REQUIRE(Decode(Encode(cp)) == std::vector<uint32_t>{cp});
+}
@@ -0,0 +1,201 @@
+// Catch2 Headers
+#include "catch2/catch_test_macros.hpp"
+
+// pTK Headers
+#include "ptk/core/WidgetContainer.hpp"
+#include "ptk/widgets/VBox.hpp"
+
+// C++ Headers
+#include <memory>
+#include <vector>
+
+class IndexRecorder : public pTK::WidgetContainer
+{
+public:
+    std::vector<size_type> updated{};
+    std::vector<size_type> drawn{};
+
+private:
+    void onChildUpdate(size_type index) override { updated.push_back(index); }
+    void onChildDraw(size_type index) override { drawn.push_back(index); }
+};
+
+static std::vector<std::shared_ptr<pTK::Widget>> AddChildren(pTK::WidgetContainer& container, std::size_t count)
+{
+    std::vector<std::shared_ptr<pTK::Widget>> children{};
+    for (std::size_t i{0}; i < count; ++i)
+    {
+        children.push_back(std::make_shared<pTK::Widget>());
+        container.add(children.back());
+    }
+    return children;
+}
+
+TEST_CASE("Child index")
+{
+    // Testing that children are resolved to the correct index.
+
+    SECTION("Add")
+    {
+        IndexRecorder container{};
+        auto children = AddChildren(container, 5);
+
+        children[3]->update();
+        children[0]->draw();
+        REQUIRE(container.updated == std::vector<IndexRecorder::size_type>{3});
+        REQUIRE(container.drawn == std::vector<IndexRecorder::size_type>{0});
+    }
+
+    SECTION("Add twice")
+    {
+        IndexRecorder container{};
+        auto children = AddChildren(container, 3);
+        container.add(children[1]);
+
+        REQUIRE(container.count() == 3);
+    }
+
+    SECTION("Remove")
+    {
+        IndexRecorder container{};
+        auto children = AddChildren(container, 5);
+        container.remove(children[1]);
+
+        REQUIRE(container.count() == 4);
+        REQUIRE(children[1]->getParent() == nullptr);
+
+        children[4]->update();
+        children[2]->draw();
+        REQUIRE(container.updated == std::vector<IndexRecorder::size_type>{3});
+        REQUIRE(container.drawn == std::vector<IndexRecorder::size_type>{1});
+        REQUIRE(container.at(3) == children[4]);
+
+        // Removed child should not be found.
+        container.updated.clear();
+        children[1]->setParent(&container);
+        children[1]->update();
+        REQUIRE(container.updated.empty());
+    }
+
+    SECTION("Moved to other container")
+    {
+        IndexRecorder first{};
+        IndexRecorder second{};
+        auto children = AddChildren(first, 3);
+        AddChildren(second, 2);
+        second.add(children[0]);
+
+        // Removed from the first container.
+        REQUIRE(first.count() == 2);
+        REQUIRE(first.at(0) == children[1]);
+        REQUIRE(children[0]->getParent() == &second);
+
+        children[0]->update();
+        children[2]->update();
+        REQUIRE(first.updated == std::vector<IndexRecorder::size_type>{1});
+        REQUIRE(second.updated == std::vector<IndexRecorder::size_type>{2});
+
+        // Moved back.
+        first.add(children[0]);
+        REQUIRE(second.count() == 2);
+        REQUIRE(first.count() == 3);
+        REQUIRE(first.at(2) == children[0]);
+    }
+}
+
+class BatchRecorder : public pTK::WidgetContainer
+{
+public:
+    std::size_t added{0};
+    std::size_t removed{0};
+    std::size_t updated{0};
+    std::size_t batches{0};
+
+private:
+    void onAdd(const value_type&) override { ++added; }
+    void onRemove(const value_type&) override { ++removed; }
+    void onChildUpdate(size_type) override { ++updated; }
+    void onBatchEnd() override { ++batches; }
+};
+
+TEST_CASE("Batch update")
+{
+    // Testing that callbacks are deferred until the batch update ends.
+
+    SECTION("addRange")
+    {
+        BatchRecorder container{};
+        std::vector<std::shared_ptr<pTK::Widget>> children(100);
+        for (auto& child : children)
+            child = std::make_shared<pTK::Widget>();
+
+        container.addRange(children.cbegin(), children.cend());
+
+        REQUIRE(container.count() == 100);
+        REQUIRE(container.added == 0);
+        REQUIRE(container.batches == 1);
+        REQUIRE(children[42]->getParent() == &container);
+        REQUIRE_FALSE(container.batching());
+    }
+
+    SECTION("Nested")
+    {
+        BatchRecorder container{};
+        {
+            pTK::WidgetContainer::BatchUpdate outer{container};
+            auto children = AddChildren(container, 10);
+            {
+                pTK::WidgetContainer::BatchUpdate inner{container};
+                container.remove(children[0]);
+                children[5]->setSize({10, 10});
+            }
+            REQUIRE(container.batching());
+            REQUIRE(container.batches == 0);
+        }
+
+        REQUIRE(container.count() == 9);
+        REQUIRE(container.added == 0);
+        REQUIRE(container.removed == 0);
+        REQUIRE(container.updated == 0);
+        REQUIRE(container.batches == 1);
+    }
+
+    SECTION("Nothing changed")
+    {
+        BatchRecorder container{};
+        container.beginBatch();
+        container.endBatch();
+        container.endBatch(); // Unmatched, ignored.
+
+        REQUIRE(container.batches == 0);
+        REQUIRE_FALSE(container.batching());
+    }
+
+    SECTION("VBox")
+    {
+        // Batched layout should be the same as adding one by one.
+        pTK::VBox single{};
+        pTK::VBox batched{};
+
+        std::vector<std::shared_ptr<pTK::Widget>> children{};
+        for (int i{0}; i < 50; ++i)
+        {
+            auto a = std::make_shared<pTK::Widget>();
+            a->setMinSize({10, static_cast<pTK::Size::value_type>(10 + (i % 7))});
+            single.add(a);
+
+            auto b = std::make_shared<pTK::Widget>();
+            b->setMinSize({10, static_cast<pTK::Size::value_type>(10 + (i % 7))});
+            children.push_back(b);
+        }
+        batched.addRange(children.cbegin(), children.cend());
+
+        REQUIRE(single.getSize() == batched.getSize());
+        REQUIRE(single.getMinSize() == batched.getMinSize());
+        for (std::size_t i{0}; i < single.count(); ++i)
+        {
+            REQUIRE(single.at(i)->getPosition() == batched.at(i)->getPosition());
+            REQUIRE(single.at(i)->getSize() == batched.at(i)->getSize());
+        }
+    }
+}
@@ -0,0 +1,411 @@
+//
+//  tests/bench/Bench.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// Benchmarks for the widget and draw pipeline.
+// Every scenario runs against a headless (raster) window, no display is needed.
+// Output is one JSON object per line and scenario, with the time and the
+// number of heap allocations per operation.
+// Pass a substring as the first argument to only run matching scenarios.
+
+// pTK Headers
+#include "ptk/Window.hpp"
+#include "ptk/core/CallbackStorage.hpp"
+#include "ptk/core/CommandBuffer.hpp"
+#include "ptk/core/CommandQueue.hpp"
+#include "ptk/core/Profiler.hpp"
+#include "ptk/events/KeyEvent.hpp"
+#include "ptk/events/MouseEvent.hpp"
+#include "ptk/widgets/Button.hpp"
+#include "ptk/widgets/HBox.hpp"
+#include "ptk/widgets/Label.hpp"
+#include "ptk/widgets/TextArea.hpp"
+#include "ptk/widgets/TextField.hpp"
+#include "ptk/widgets/VBox.hpp"
+
+// C++ Headers
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Allocation counters, updated by the global operator new below.
+static std::atomic<uint64_t> s_allocs{0};
+static std::atomic<uint64_t> s_allocBytes{0};
+
+void* operator new(std::size_t size)
+{
+    s_allocs.fetch_add(1, std::memory_order_relaxed);
+    s_allocBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc((size > 0) ? size : 1))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+// Minimum time spent when calibrating and the target time for a measurement.
+static constexpr std::chrono::nanoseconds s_calibrateTime{std::chrono::milliseconds(10)};
+static constexpr std::chrono::nanoseconds s_targetTime{std::chrono::milliseconds(200)};
+
+static std::string_view s_filter{};
+
+struct Measurement
+{
+    uint64_t iterations{0};
+    uint64_t ns{0};
+    uint64_t allocs{0};
+    uint64_t bytes{0};
+};
+
+static Measurement Measure(const std::function<void()>& op, uint64_t iterations)
+{
+    using namespace std::chrono;
+
+    const uint64_t allocs{s_allocs.load(std::memory_order_relaxed)};
+    const uint64_t bytes{s_allocBytes.load(std::memory_order_relaxed)};
+    const auto start{steady_clock::now()};
+    for (uint64_t i{0}; i < iterations; ++i)
+        op();
+    const auto elapsed{duration_cast<nanoseconds>(steady_clock::now() - start)};
+
+    return {iterations, static_cast<uint64_t>(elapsed.count()), s_allocs.load(std::memory_order_relaxed) - allocs,
+            s_allocBytes.load(std::memory_order_relaxed) - bytes};
+}
+
+static void Run(std::string_view name, const std::function<void()>& op)
+{
+    if (!s_filter.empty() && name.find(s_filter) == std::string_view::npos)
+        return;
+
+    // Warm up and find an iteration count that takes long enough to be measured.
+    uint64_t iterations{1};
+    Measurement m{Measure(op, iterations)};
+    while (m.ns < static_cast<uint64_t>(s_calibrateTime.count()))
+    {
+        iterations *= 2;
+        m = Measure(op, iterations);
+    }
+
+    // Scale the count to the target time.
+    const uint64_t nsPerOp{std::max<uint64_t>(m.ns / m.iterations, 1)};
+    iterations = std::max<uint64_t>(static_cast<uint64_t>(s_targetTime.count()) / nsPerOp, 1);
+    m = Measure(op, iterations);
+
+    const double perOp{1.0 / static_cast<double>(m.iterations)};
+    std::cout << "{\"benchmark\":\"" << name << "\",\"iterations\":" << m.iterations
+              << ",\"ns_per_op\":" << (static_cast<double>(m.ns) * perOp)
+              << ",\"allocs_per_op\":" << (static_cast<double>(m.allocs) * perOp)
+              << ",\"bytes_per_op\":" << (static_cast<double>(m.bytes) * perOp) << "}" << std::endl;
+}
+
+static std::unique_ptr<pTK::Window> MakeWindow(const pTK::Size& size)
+{
+    pTK::WindowInfo info{};
+    info.backend = pTK::WindowInfo::Backend::Headless;
+    auto window = std::make_unique<pTK::Window>("Bench", size, info);
+    window->show();
+    return window;
+}
+
+static void BenchLabels(std::size_t count)
+{
+    auto window{MakeWindow({1280, 720})};
+    for (std::size_t i{0}; i < count; ++i)
+    {
+        auto label = std::make_shared<pTK::Label>();
+        label->setText("Label " + std::to_string(i));
+        window->add(label);
+    }
+
+    Run("render_labels_" + std::to_string(count), [&window]() { window->renderFrame(); });
+}
+
+static void BenchButtons(std::size_t rows, std::size_t columns)
+{
+    auto window{MakeWindow({1280, 720})};
+    for (std::size_t r{0}; r < rows; ++r)
+    {
+        auto row = std::make_shared<pTK::HBox>();
+        for (std::size_t c{0}; c < columns; ++c)
+        {
+            auto column = std::make_shared<pTK::VBox>();
+            auto button = std::make_shared<pTK::Button>();
+            button->setText("Button");
+            column->add(button);
+            row->add(column);
+        }
+        window->add(row);
+    }
+
+    Run("render_buttons_" + std::to_string(rows * columns), [&window]() { window->renderFrame(); });
+}
+
+static void BenchResize()
+{
+    auto window{MakeWindow({1280, 720})};
+    for (std::size_t i{0}; i < 100; ++i)
+        window->add(std::make_shared<pTK::Button>());
+
+    bool large{false};
+    Run("resize_storm", [&window, &large]() {
+        large = !large;
+        window->setSize(large ? pTK::Size{1280, 720} : pTK::Size{800, 600});
+        window->renderFrame();
+    });
+}
+
+static void BenchHover()
+{
+    auto window{MakeWindow({1280, 720})};
+    for (std::size_t i{0}; i < 200; ++i)
+        window->add(std::make_shared<pTK::Button>());
+    window->renderFrame();
+
+    // Sweep the mouse from top to bottom, crossing every child.
+    const pTK::Point::value_type x{static_cast<pTK::Point::value_type>(window->getSize().width / 2)};
+    const pTK::Point::value_type height{static_cast<pTK::Point::value_type>(window->getSize().height)};
+    pTK::Point::value_type y{0};
+    Run("hover_sweep", [&window, x, height, &y]() {
+        y = (y + 1) % height;
+        window->handleEvent<pTK::MotionEvent>(pTK::MotionEvent{{x, y}});
+    });
+}
+
+static void BenchTyping()
+{
+    auto window{MakeWindow({640, 480})};
+    auto field = std::make_shared<pTK::TextField>();
+    window->add(field);
+
+    // Typing burst of 64 characters, the field is cleared between bursts.
+    Run("textfield_typing_burst_64", [&field]() {
+        for (uint32_t i{0}; i < 64; ++i)
+        {
+            const pTK::InputEvent::data_type data{'a' + (i % 26)};
+            field->handleEvent<pTK::InputEvent>(pTK::InputEvent{&data, 1});
+        }
+        field->setText("");
+    });
+}
+
+static void BenchTextArea(std::size_t lines)
+{
+    std::string text{};
+    for (std::size_t i{0}; i < lines; ++i)
+        text += "[" + std::to_string(i) + "] request handled by worker " + std::to_string(i % 16) + " in 12 ms\n";
+
+    const std::string suffix{std::to_string(lines / 1000) + "k"};
+    auto area = std::make_shared<pTK::TextArea>();
+    Run("textlayout_settext_" + suffix, [&area, &text]() { area->setText(text); });
+
+    // Only the lines that change at the new width are broken again.
+    float width{300.0f};
+    pTK::TextLayout layout{area->layout()};
+    Run("textlayout_resize_" + suffix, [&layout, &width]() {
+        width = (width >= 400.0f) ? 300.0f : (width + 1.0f);
+        layout.setWidth(width);
+    });
+
+    auto window{MakeWindow({640, 480})};
+    window->add(area);
+    window->renderFrame();
+    Run("render_textarea_" + suffix, [&window, &area]() {
+        area->draw();
+        window->renderFrame();
+    });
+}
+
+static void BenchCallbacks(std::size_t count)
+{
+    pTK::CallbackStorage storage{};
+    uint64_t sum{0};
+    for (std::size_t i{0}; i < count; ++i)
+        storage.addCallback<pTK::MotionEvent, bool(const pTK::MotionEvent&)>([&sum](const pTK::MotionEvent& evt) {
+            sum += static_cast<uint64_t>(evt.pos.x);
+            return false;
+        });
+
+    const pTK::MotionEvent evt{{1, 1}};
+    Run("callback_trigger_" + std::to_string(count), [&storage, &evt]() {
+        storage.triggerCallbacks<pTK::MotionEvent, bool(const pTK::MotionEvent&)>(evt);
+    });
+}
+
+static void BenchCallbackLookup()
+{
+    // Callbacks for other event types, none for the triggered one.
+    // Measures the lookup, which is done for every event and widget level.
+    pTK::CallbackStorage storage{};
+    storage.addCallback<pTK::ClickEvent, bool(const pTK::ClickEvent&)>([](const pTK::ClickEvent&) { return false; });
+    storage.addCallback<pTK::ReleaseEvent, bool(const pTK::ReleaseEvent&)>(
+        [](const pTK::ReleaseEvent&) { return false; });
+    storage.addCallback<pTK::ScrollEvent, bool(const pTK::ScrollEvent&)>(
+        [](const pTK::ScrollEvent&) { return false; });
+    storage.addCallback<pTK::KeyEvent, bool(const pTK::KeyEvent&)>([](const pTK::KeyEvent&) { return false; });
+
+    const pTK::MotionEvent evt{{1, 1}};
+    Run("callback_trigger_empty", [&storage, &evt]() {
+        storage.triggerCallbacks<pTK::MotionEvent, bool(const pTK::MotionEvent&)>(evt);
+    });
+}
+
+static void BenchListeners()
+{
+    // Adding and removing a typical widget listener, capturing a few values.
+    // A listener is kept to not measure the creation of the storage node.
+    pTK::Widget widget{};
+    widget.addListener<pTK::MotionEvent>([]() { return false; });
+
+    uint64_t sum{0};
+    uint64_t step{1};
+    Run("listener_add_remove", [&widget, &sum, &step]() {
+        const uint64_t id{widget.addListener<pTK::MotionEvent>([&sum, &widget, step](const pTK::MotionEvent&) {
+            sum += widget.getSize().width + step;
+            return false;
+        })};
+        widget.removeListener<pTK::MotionEvent>(id);
+    });
+}
+
+static void BenchOneShotListeners(std::size_t count)
+{
+    // Listeners that remove themselves when called.
+    pTK::Widget widget{};
+    Run("listener_one_shot_" + std::to_string(count), [&widget, count]() {
+        for (std::size_t i{0}; i < count; ++i)
+            widget.addListener<pTK::MotionEvent>([]() { return true; });
+        widget.triggerEvent<pTK::MotionEvent>(pTK::MotionEvent{{1, 1}});
+    });
+}
+
+// Posts commands from several threads while the current thread runs them.
+template <typename Post, typename Drain>
+static void PostCommands(std::size_t producers, std::size_t commands, Post post, Drain drain)
+{
+    std::atomic<std::size_t> done{0};
+    std::vector<std::thread> threads{};
+    for (std::size_t p{0}; p < producers; ++p)
+        threads.emplace_back([&post, &done, commands]() {
+            for (std::size_t i{0}; i < commands; ++i)
+                post([&done]() { done.fetch_add(1, std::memory_order_relaxed); });
+        });
+
+    while (done.load(std::memory_order_relaxed) < producers * commands)
+        drain();
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+static void BenchPostCommand(std::size_t producers, std::size_t commands)
+{
+    const std::string suffix{std::to_string(producers) + "x" + std::to_string(commands)};
+
+    // Mutex protected CommandBuffer, the previous Window::postCommand design.
+    {
+        std::mutex mutex{};
+        pTK::CommandBuffer<void()> buffer{};
+        const auto post = [&](auto cmd) {
+            std::lock_guard<std::mutex> lock{mutex};
+            buffer.add(std::move(cmd));
+        };
+        const auto drain = [&]() {
+            pTK::CommandBuffer<void()> current{};
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                current = std::move(buffer);
+            }
+            current.batchInvoke();
+        };
+        Run("command_post_mutex_" + suffix, [&]() { PostCommands(producers, commands, post, drain); });
+        if (producers == 1)
+            Run("command_push_run_mutex_1000", [&]() {
+                for (std::size_t i{0}; i < 1000; ++i)
+                    post([]() {});
+                drain();
+            });
+    }
+
+    // Lock-free CommandQueue.
+    {
+        pTK::CommandQueue<void()> queue{};
+        const auto post = [&](auto cmd) { queue.push(std::move(cmd)); };
+        const auto drain = [&]() { queue.run(); };
+        Run("command_post_mpsc_" + suffix, [&]() { PostCommands(producers, commands, post, drain); });
+        if (producers == 1)
+            Run("command_push_run_mpsc_1000", [&]() {
+                for (std::size_t i{0}; i < 1000; ++i)
+                    post([]() {});
+                drain();
+            });
+    }
+}
+
+static void BenchProfileZone()
+{
+    // Cost of a profiling zone when PTK_PROFILE is enabled (the macros are empty otherwise).
+    Run("profile_zone", []() { const pTK::ProfileZone zone{"bench"}; });
+    pTK::Profiler::Clear();
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1)
+        s_filter = argv[1];
+
+    BenchLabels(100);
+    BenchLabels(1000);
+    BenchButtons(10, 10);
+    BenchButtons(30, 30);
+    BenchResize();
+    BenchHover();
+    BenchTyping();
+    BenchTextArea(100000);
+    BenchCallbacks(1);
+    BenchCallbacks(100);
+    BenchCallbackLookup();
+    BenchListeners();
+    BenchOneShotListeners(1000);
+    BenchPostCommand(1, 10000);
+    BenchPostCommand(4, 10000);
+    BenchProfileZone();
+
+    return 0;
+}
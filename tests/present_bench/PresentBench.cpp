@@ -0,0 +1,80 @@
+//
+//  tests/present_bench/PresentBench.cpp
+//  pTK
+//
+//  Created by Robin Gustafsson on 2023-06-10.
+//
+
+// Measures the cost of presenting a software rendered 1080p window when
+// everything is damaged compared to when only 1% of the window is damaged.
+// Run with PTK_X11_NO_SHM=1 to measure the XPutImage fallback.
+// Output is one "key=value" line per scenario.
+
+// pTK Headers
+#include "ptk/Application.hpp"
+#include "ptk/Window.hpp"
+#include "ptk/core/ContextBase.hpp"
+#include "ptk/core/DamageRegion.hpp"
+
+// C++ Headers
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+static constexpr int s_frames{200};
+
+static std::size_t RegionBytes(const pTK::DamageRegion& region)
+{
+    std::size_t bytes{0};
+    for (const pTK::Rect& rect : region)
+        bytes += static_cast<std::size_t>(rect.size.width) * rect.size.height * sizeof(uint32_t);
+    return bytes;
+}
+
+static void Run(std::string_view name, pTK::ContextBase* context, const pTK::DamageRegion& region)
+{
+    using namespace std::chrono;
+
+    // Warm up.
+    for (int i{0}; i < 10; ++i)
+        context->swapBuffers(region);
+
+    const auto start{steady_clock::now()};
+    for (int i{0}; i < s_frames; ++i)
+        context->swapBuffers(region);
+    const auto elapsed{duration_cast<nanoseconds>(steady_clock::now() - start).count()};
+
+    const char* mode{(std::getenv("PTK_X11_NO_SHM") != nullptr) ? "xputimage" : "default"};
+    std::cout << "scenario=" << name << " mode=" << mode << " frames=" << s_frames
+              << " bytes_per_frame=" << RegionBytes(region)
+              << " ns_per_frame=" << (elapsed / s_frames) << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    pTK::Application app{"PresentBench", argc, argv};
+
+    pTK::WindowInfo flags{};
+    flags.backend = pTK::WindowInfo::Backend::Software;
+    pTK::Window window{"PresentBench", {1920, 1080}, flags};
+    window.show();
+
+    pTK::ContextBase* context{window.getContext()};
+    const pTK::Size size{context->getSize()};
+
+    pTK::DamageRegion full{};
+    full.add({{0, 0}, size});
+
+    // A 1% damaged area, split into a few rectangles like a typical UI update.
+    pTK::DamageRegion partial{};
+    const pTK::Size::value_type width{size.width / 10};
+    const pTK::Size::value_type height{size.height / 40};
+    for (int i{0}; i < 4; ++i)
+        partial.add({{100 + (i * 400), 100 + (i * 200)}, {width, height}});
+
+    Run("full", context, full);
+    Run("partial_1pct", context, partial);
+
+    return 0;
+}